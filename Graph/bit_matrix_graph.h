@@ -0,0 +1,337 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+#include "graph.h"
+
+//      ,   .
+//      64- :  j  i ,    (i, j).
+//     ( i - ,       i).
+//   -    ,       :
+//      (OR)    .
+//  - V^2 / 4  (   V^2 ),       
+// (   );  ,    MaxNodeCount ,  .
+template <class NodeType>
+class BitMatrixGraph
+{
+public:
+	typedef uint32_t NodeId; //    
+	typedef typename Graph<NodeType>::Edge Edge; //  (. Graph::Edge)
+
+	static constexpr size_t MaxNodeCount = 1 << 15; //     (  256 )
+
+	//      theGraph (   )  O(V^2 / 32 + V log V + E):
+	//       ,   .
+	//   theGraph    .
+	//   std::length_error,     MaxNodeCount .
+	template <class NodeIndex>
+	explicit BitMatrixGraph(const Graph<NodeType, NodeIndex>& theGraph);
+	BitMatrixGraph(const BitMatrixGraph&);
+	BitMatrixGraph& operator=(const BitMatrixGraph&);
+	~BitMatrixGraph();
+
+	//      .
+	size_t GetNodeCount() const { return myNodes.size(); }
+
+	//   ,     .   .
+	bool ContainsNode(const NodeType& theNode) const;
+
+	//   ,     .   .
+	bool ContainsEdge(const Edge& theEdge) const;
+
+	//   true,     (. Graph::IsGraphConnected).
+	//   O(V^2 / 64):   (     )   .
+	bool IsGraphConnected() const;
+
+	//   true,    theBeginNode  theEndNode  
+	// (. Graph::ExistsPathBetweenTwoNodes).
+	//   std::invalid_argument,          .
+	bool ExistsPathBetweenTwoNodes(const NodeType& theBeginNode, const NodeType& theEndNode) const;
+
+	//   .       Graph.
+	friend std::ostream& operator<<(std::ostream& theOut, const BitMatrixGraph<NodeType>& theGraph)
+	{
+		for (NodeId anId = 0; anId < theGraph.myNodes.size(); ++anId)
+		{
+			theOut << theGraph.myNodes[anId] << " : {";
+			bool aFirstElementWasPrinted = false;
+			for (NodeId aNeighbor = 0; aNeighbor < theGraph.myNodes.size(); ++aNeighbor)
+			{
+				if (!testBit(theGraph.getRow(theGraph.myRows, anId), aNeighbor))
+				{
+					continue;
+				}
+				const NodeType& aNode = theGraph.myNodes[aNeighbor];
+				if (aFirstElementWasPrinted)
+				{
+					theOut << ", " << aNode;
+				}
+				else
+				{
+					theOut << " " << aNode;
+					aFirstElementWasPrinted = true;
+				}
+			}
+			theOut << " }" << std::endl;
+		}
+		return theOut;
+	}
+
+private:
+	typedef uint64_t Word; //   
+
+	//    .  false,     .
+	bool findNodeId(const NodeType& theNode, NodeId& theId) const;
+
+	//       theId  theMatrix.
+	const Word* getRow(const std::vector<Word>& theMatrix, NodeId theId) const { return theMatrix.data() + theId * myWordsPerRow; }
+
+	//    theIndex   theRow.
+	static bool testBit(const Word* theRow, NodeId theIndex) { return (theRow[theIndex / 64] >> (theIndex % 64)) & 1; }
+
+	//        (    ).
+	static unsigned lowestBitIndex(Word theWord);
+
+	//     theMatrix,    theVisited (theVisited    ).
+	//   theVisited   ,     (  ).
+	//  theStopId   ,  ,     .
+	void sweep(const std::vector<Word>& theMatrix, std::vector<Word>& theVisited, NodeId theStopId) const;
+
+private:
+	std::vector<NodeType> myNodes; //     (  -  )
+	size_t myWordsPerRow;          //     
+	std::vector<Word> myRows;      //  ,   
+	std::vector<Word> myColumns;   //   
+};
+
+//=========================================================
+// Function : BitMatrixGraph
+// Purpose  :    
+//=========================================================
+template <class NodeType>
+template <class NodeIndex>
+BitMatrixGraph<NodeType>::BitMatrixGraph(const Graph<NodeType, NodeIndex>& theGraph)
+{
+	if (theGraph.GetNodeCount() > MaxNodeCount)
+	{
+		throw std::length_error("Graph has too many nodes for a bit matrix snapshot");
+	}
+
+	std::vector<NodeId> aGraphIds; //        
+	theGraph.getIdsInNodeOrder(aGraphIds);
+
+	std::vector<NodeId> aSnapshotIds(theGraph.myNodes.size()); //     ->   
+	myNodes.reserve(aGraphIds.size());
+	for (NodeId anId = 0; anId < aGraphIds.size(); ++anId)
+	{
+		myNodes.push_back(theGraph.myNodes[aGraphIds[anId]]);
+		aSnapshotIds[aGraphIds[anId]] = anId;
+	}
+
+	myWordsPerRow = (myNodes.size() + 63) / 64;
+	myRows.assign(myNodes.size() * myWordsPerRow, 0);
+	myColumns.assign(myNodes.size() * myWordsPerRow, 0);
+
+	for (NodeId aBeginId = 0; aBeginId < aGraphIds.size(); ++aBeginId)
+	{
+		for (NodeId anEndGraphId : theGraph.myAdjacency[aGraphIds[aBeginId]])
+		{
+			const NodeId anEndId = aSnapshotIds[anEndGraphId];
+			myRows[aBeginId * myWordsPerRow + anEndId / 64] |= Word(1) << (anEndId % 64);
+			myColumns[anEndId * myWordsPerRow + aBeginId / 64] |= Word(1) << (aBeginId % 64);
+		}
+	}
+}
+
+//=========================================================
+// Function : BitMatrixGraph
+// Purpose  : Copy constructor
+//=========================================================
+template <class NodeType>
+BitMatrixGraph<NodeType>::BitMatrixGraph(const BitMatrixGraph<NodeType>&) = default;
+
+//=========================================================
+// Function : operator=
+// Purpose  : Assignment operator
+//=========================================================
+template <class NodeType>
+BitMatrixGraph<NodeType>& BitMatrixGraph<NodeType>::operator=(const BitMatrixGraph<NodeType>&) = default;
+
+//=========================================================
+// Function : ~BitMatrixGraph
+// Purpose  : Destructor
+//=========================================================
+template <class NodeType>
+BitMatrixGraph<NodeType>::~BitMatrixGraph() = default;
+
+//=========================================================
+// Function : ContainsNode
+// Purpose  : ,     
+//=========================================================
+template <class NodeType>
+bool BitMatrixGraph<NodeType>::ContainsNode(const NodeType& theNode) const
+{
+	NodeId anId = 0;
+	return findNodeId(theNode, anId);
+}
+
+//=========================================================
+// Function : ContainsEdge
+// Purpose  : ,     
+//=========================================================
+template <class NodeType>
+bool BitMatrixGraph<NodeType>::ContainsEdge(const Edge& theEdge) const
+{
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (!findNodeId(theEdge.first, aBeginId) || !findNodeId(theEdge.second, anEndId))
+	{
+		return false;
+	}
+	return testBit(getRow(myRows, aBeginId), anEndId);
+}
+
+//=========================================================
+// Function : IsGraphConnected
+// Purpose  : ,    
+//=========================================================
+template <class NodeType>
+bool BitMatrixGraph<NodeType>::IsGraphConnected() const
+{
+	//     
+	if (myNodes.empty())
+		return false;
+
+	const NodeId aNodeCount = static_cast<NodeId>(myNodes.size());
+
+	//      ,    0    (  )
+	//   0     (  ).
+	for (const std::vector<Word>* aMatrix : { &myRows, &myColumns })
+	{
+		std::vector<Word> aVisited(myWordsPerRow, 0);
+		aVisited[0] = 1;
+		sweep(*aMatrix, aVisited, aNodeCount);
+
+		size_t aVisitedCount = 0;
+		for (Word aWord : aVisited)
+		{
+			for (; aWord != 0; aWord &= aWord - 1)
+			{
+				++aVisitedCount;
+			}
+		}
+		if (aVisitedCount != myNodes.size())
+			return false;
+	}
+	return true;
+}
+
+//=========================================================
+// Function : ExistsPathBetweenTwoNodes
+// Purpose  : ,      
+//=========================================================
+template <class NodeType>
+bool BitMatrixGraph<NodeType>::ExistsPathBetweenTwoNodes(const NodeType& theBeginNode, const NodeType& theEndNode) const
+{
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (!findNodeId(theBeginNode, aBeginId) || !findNodeId(theEndNode, anEndId))
+	{
+		throw std::invalid_argument("Graph does not contain at least one of given nodes");
+	}
+
+	//       ,   
+	//  ,   ,      .
+	const Word* aBeginRow = getRow(myRows, aBeginId);
+	std::vector<Word> aVisited(aBeginRow, aBeginRow + myWordsPerRow);
+	sweep(myRows, aVisited, anEndId);
+	return testBit(aVisited.data(), anEndId);
+}
+
+//=========================================================
+// Function : findNodeId
+// Purpose  :   
+//=========================================================
+template <class NodeType>
+bool BitMatrixGraph<NodeType>::findNodeId(const NodeType& theNode, NodeId& theId) const
+{
+	auto anIter = std::lower_bound(myNodes.cbegin(), myNodes.cend(), theNode);
+	if (anIter == myNodes.cend() || theNode < *anIter)
+	{
+		return false;
+	}
+	theId = static_cast<NodeId>(anIter - myNodes.cbegin());
+	return true;
+}
+
+//=========================================================
+// Function : lowestBitIndex
+// Purpose  :    
+//=========================================================
+template <class NodeType>
+unsigned BitMatrixGraph<NodeType>::lowestBitIndex(Word theWord)
+{
+	//            6 
+	//  ,       .     .
+	static const unsigned aTable[64] =
+	{
+		 0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+		62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+		63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+		46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6
+	};
+	const Word aLowestBit = theWord & (~theWord + 1);
+	return aTable[(aLowestBit * 0x03f79d71b4cb0a89ull) >> 58];
+}
+
+//=========================================================
+// Function : sweep
+// Purpose  :   
+//=========================================================
+template <class NodeType>
+void BitMatrixGraph<NodeType>::sweep(const std::vector<Word>& theMatrix, std::vector<Word>& theVisited, NodeId theStopId) const
+{
+	const bool aHasStopNode = theStopId < myNodes.size();
+	std::vector<Word> aFrontier(theVisited);
+	std::vector<Word> aNextFrontier(myWordsPerRow);
+
+	bool aFrontierIsEmpty = false;
+	while (!aFrontierIsEmpty)
+	{
+		if (aHasStopNode && testBit(theVisited.data(), theStopId))
+		{
+			return;
+		}
+
+		//   -      
+		std::fill(aNextFrontier.begin(), aNextFrontier.end(), 0);
+		for (size_t aWordIndex = 0; aWordIndex < myWordsPerRow; ++aWordIndex)
+		{
+			for (Word aWord = aFrontier[aWordIndex]; aWord != 0; aWord &= aWord - 1)
+			{
+				const NodeId anId = static_cast<NodeId>(aWordIndex * 64 + lowestBitIndex(aWord));
+				const Word* aRow = getRow(theMatrix, anId);
+				for (size_t i = 0; i < myWordsPerRow; ++i)
+				{
+					aNextFrontier[i] |= aRow[i];
+				}
+			}
+		}
+
+		//         
+		aFrontierIsEmpty = true;
+		for (size_t i = 0; i < myWordsPerRow; ++i)
+		{
+			aFrontier[i] = aNextFrontier[i] & ~theVisited[i];
+			theVisited[i] |= aFrontier[i];
+			if (aFrontier[i] != 0)
+			{
+				aFrontierIsEmpty = false;
+			}
+		}
+	}
+}
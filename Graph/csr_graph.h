@@ -0,0 +1,316 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+#include "graph.h"
+#include "traversal_workspace.h"
+
+//      CSR (compressed sparse row).
+//     (  -      ),
+//        :      .
+//     i   myNeighbors[myOffsets[i] .. myOffsets[i + 1]).
+//    ,     :
+//        ,        ,
+//      ,  .
+template <class NodeType>
+class CsrGraph
+{
+public:
+	typedef uint32_t NodeId; //    
+	typedef typename Graph<NodeType>::Edge Edge; //  (. Graph::Edge)
+
+	//      theGraph (   )  O(V log V + E):
+	//    ,         ,   .
+	//   theGraph    .
+	template <class NodeIndex>
+	explicit CsrGraph(const Graph<NodeType, NodeIndex>& theGraph);
+	CsrGraph(const CsrGraph&);
+	CsrGraph& operator=(const CsrGraph&);
+	~CsrGraph();
+
+	//      .
+	size_t GetNodeCount() const { return myNodes.size(); }
+
+	//      .
+	size_t GetEdgeCount() const { return myNeighbors.size(); }
+
+	//   ,     .   .
+	bool ContainsNode(const NodeType& theNode) const;
+
+	//   ,     .   .
+	bool ContainsEdge(const Edge& theEdge) const;
+
+	//   true,     (. Graph::IsGraphConnected).
+	//   O(V + E):             .
+	//       (. GetThreadTraversalWorkspace)    .
+	bool IsGraphConnected() const;
+
+	//   true,    theBeginNode  theEndNode  
+	// (. Graph::ExistsPathBetweenTwoNodes).      .
+	//   std::invalid_argument,          .
+	bool ExistsPathBetweenTwoNodes(const NodeType& theBeginNode, const NodeType& theEndNode) const;
+
+	//   .       Graph.
+	friend std::ostream& operator<<(std::ostream& theOut, const CsrGraph<NodeType>& theGraph)
+	{
+		for (NodeId anId = 0; anId < theGraph.myNodes.size(); ++anId)
+		{
+			theOut << theGraph.myNodes[anId] << " : {";
+			bool aFirstElementWasPrinted = false;
+			for (size_t i = theGraph.myOffsets[anId]; i < theGraph.myOffsets[anId + 1]; ++i)
+			{
+				const NodeType& aNode = theGraph.myNodes[theGraph.myNeighbors[i]];
+				if (aFirstElementWasPrinted)
+				{
+					theOut << ", " << aNode;
+				}
+				else
+				{
+					theOut << " " << aNode;
+					aFirstElementWasPrinted = true;
+				}
+			}
+			theOut << " }" << std::endl;
+		}
+		return theOut;
+	}
+
+private:
+	//    .  false,     .
+	bool findNodeId(const NodeType& theNode, NodeId& theId) const;
+
+	//      theWorkspace  ,    theStartId    
+	// theOffsets  theNeighbors.   theStartId  .
+	//    .
+	static size_t markReachableNodes(NodeId theStartId,
+	                                 const std::vector<size_t>& theOffsets,
+	                                 const std::vector<NodeId>& theNeighbors,
+	                                 TraversalWorkspace& theWorkspace);
+
+private:
+	std::vector<NodeType> myNodes; //     (  -  )
+
+	std::vector<size_t> myOffsets;   //    ( -   + 1)
+	std::vector<NodeId> myNeighbors; //   ;      
+
+	std::vector<size_t> myReverseOffsets;   //    
+	std::vector<NodeId> myReverseNeighbors; //    
+};
+
+//=========================================================
+// Function : CsrGraph
+// Purpose  :    
+//=========================================================
+template <class NodeType>
+template <class NodeIndex>
+CsrGraph<NodeType>::CsrGraph(const Graph<NodeType, NodeIndex>& theGraph)
+{
+	std::vector<NodeId> aGraphIds; //        
+	theGraph.getIdsInNodeOrder(aGraphIds);
+
+	const size_t aNodeCount = aGraphIds.size();
+	std::vector<NodeId> aSnapshotIds(theGraph.myNodes.size()); //     ->   
+	myNodes.reserve(aNodeCount);
+	myOffsets.assign(aNodeCount + 1, 0);
+	for (NodeId anId = 0; anId < aNodeCount; ++anId)
+	{
+		myNodes.push_back(theGraph.myNodes[aGraphIds[anId]]);
+		aSnapshotIds[aGraphIds[anId]] = anId;
+		myOffsets[anId + 1] = myOffsets[anId] + theGraph.myAdjacency[aGraphIds[anId]].size();
+	}
+
+	//       ,   ,   
+	//  :    (      ),
+	//     (      ).
+	myReverseOffsets.assign(aNodeCount + 1, 0);
+	for (NodeId aGraphId : aGraphIds)
+	{
+		for (NodeId anEndId : theGraph.myAdjacency[aGraphId])
+		{
+			++myReverseOffsets[aSnapshotIds[anEndId] + 1];
+		}
+	}
+	for (size_t i = 1; i < myReverseOffsets.size(); ++i)
+	{
+		myReverseOffsets[i] += myReverseOffsets[i - 1];
+	}
+	myReverseNeighbors.resize(myOffsets.back());
+	std::vector<size_t> aPositions(myReverseOffsets.begin(), myReverseOffsets.end() - 1);
+	for (NodeId anId = 0; anId < aNodeCount; ++anId)
+	{
+		for (NodeId anEndId : theGraph.myAdjacency[aGraphIds[anId]])
+		{
+			myReverseNeighbors[aPositions[aSnapshotIds[anEndId]]++] = anId;
+		}
+	}
+
+	myNeighbors.resize(myOffsets.back());
+	aPositions.assign(myOffsets.begin(), myOffsets.end() - 1);
+	for (NodeId anId = 0; anId < aNodeCount; ++anId)
+	{
+		for (size_t i = myReverseOffsets[anId]; i < myReverseOffsets[anId + 1]; ++i)
+		{
+			myNeighbors[aPositions[myReverseNeighbors[i]]++] = anId;
+		}
+	}
+}
+
+//=========================================================
+// Function : CsrGraph
+// Purpose  : Copy constructor
+//=========================================================
+template <class NodeType>
+CsrGraph<NodeType>::CsrGraph(const CsrGraph<NodeType>&) = default;
+
+//=========================================================
+// Function : operator=
+// Purpose  : Assignment operator
+//=========================================================
+template <class NodeType>
+CsrGraph<NodeType>& CsrGraph<NodeType>::operator=(const CsrGraph<NodeType>&) = default;
+
+//=========================================================
+// Function : ~CsrGraph
+// Purpose  : Destructor
+//=========================================================
+template <class NodeType>
+CsrGraph<NodeType>::~CsrGraph() = default;
+
+//=========================================================
+// Function : ContainsNode
+// Purpose  : ,     
+//=========================================================
+template <class NodeType>
+bool CsrGraph<NodeType>::ContainsNode(const NodeType& theNode) const
+{
+	NodeId anId = 0;
+	return findNodeId(theNode, anId);
+}
+
+//=========================================================
+// Function : ContainsEdge
+// Purpose  : ,     
+//=========================================================
+template <class NodeType>
+bool CsrGraph<NodeType>::ContainsEdge(const Edge& theEdge) const
+{
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (!findNodeId(theEdge.first, aBeginId) || !findNodeId(theEdge.second, anEndId))
+	{
+		return false;
+	}
+
+	//   ,    
+	auto aBegin = myNeighbors.cbegin() + myOffsets[aBeginId];
+	auto anEnd = myNeighbors.cbegin() + myOffsets[aBeginId + 1];
+	return std::binary_search(aBegin, anEnd, anEndId);
+}
+
+//=========================================================
+// Function : IsGraphConnected
+// Purpose  : ,    
+//=========================================================
+template <class NodeType>
+bool CsrGraph<NodeType>::IsGraphConnected() const
+{
+	//     
+	if (myNodes.empty())
+		return false;
+
+	//      ,    0   
+	//   0     (         ).
+	TraversalWorkspace& aWorkspace = GetThreadTraversalWorkspace();
+	if (markReachableNodes(0, myOffsets, myNeighbors, aWorkspace) != myNodes.size())
+		return false;
+
+	return markReachableNodes(0, myReverseOffsets, myReverseNeighbors, aWorkspace) == myNodes.size();
+}
+
+//=========================================================
+// Function : ExistsPathBetweenTwoNodes
+// Purpose  : ,      
+//=========================================================
+template <class NodeType>
+bool CsrGraph<NodeType>::ExistsPathBetweenTwoNodes(const NodeType& theBeginNode, const NodeType& theEndNode) const
+{
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (!findNodeId(theBeginNode, aBeginId) || !findNodeId(theEndNode, anEndId))
+	{
+		throw std::invalid_argument("Graph does not contain at least one of given nodes");
+	}
+
+	//        :
+	//       ,      .
+	TraversalWorkspace& aWorkspace = GetThreadTraversalWorkspace();
+	aWorkspace.Reset(myNodes.size());
+	aWorkspace.Push(aBeginId);
+
+	NodeId aCurrentId = 0;
+	while (aWorkspace.Pop(aCurrentId))
+	{
+		for (size_t i = myOffsets[aCurrentId]; i < myOffsets[aCurrentId + 1]; ++i)
+		{
+			const NodeId aNeighbor = myNeighbors[i];
+			if (aNeighbor == anEndId)
+			{
+				return true;
+			}
+			if (aWorkspace.Visit(aNeighbor))
+			{
+				aWorkspace.Push(aNeighbor);
+			}
+		}
+	}
+	return false;
+}
+
+//=========================================================
+// Function : findNodeId
+// Purpose  :   
+//=========================================================
+template <class NodeType>
+bool CsrGraph<NodeType>::findNodeId(const NodeType& theNode, NodeId& theId) const
+{
+	auto anIter = std::lower_bound(myNodes.cbegin(), myNodes.cend(), theNode);
+	if (anIter == myNodes.cend() || theNode < *anIter)
+	{
+		return false;
+	}
+	theId = static_cast<NodeId>(anIter - myNodes.cbegin());
+	return true;
+}
+
+//=========================================================
+// Function : markReachableNodes
+// Purpose  :   ,   
+//=========================================================
+template <class NodeType>
+size_t CsrGraph<NodeType>::markReachableNodes(NodeId theStartId,
+                                              const std::vector<size_t>& theOffsets,
+                                              const std::vector<NodeId>& theNeighbors,
+                                              TraversalWorkspace& theWorkspace)
+{
+	theWorkspace.Reset(theOffsets.size() - 1);
+	theWorkspace.Visit(theStartId);
+	theWorkspace.Push(theStartId);
+
+	NodeId aCurrentId = 0;
+	while (theWorkspace.Pop(aCurrentId))
+	{
+		for (size_t i = theOffsets[aCurrentId]; i < theOffsets[aCurrentId + 1]; ++i)
+		{
+			const NodeId aNeighbor = theNeighbors[i];
+			if (theWorkspace.Visit(aNeighbor))
+			{
+				theWorkspace.Push(aNeighbor);
+			}
+		}
+	}
+	return theWorkspace.GetPushedCount();
+}
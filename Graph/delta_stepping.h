@@ -0,0 +1,237 @@
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+
+#include "thread_barrier.h"
+#include "thread_pool.h"
+
+//            (delta-stepping).
+//      theDelta   .    :
+//      (   theDelta)    ,  
+//  ,    -     ,   .
+//      ,      ;  
+//   "  ",        
+//   ,       .
+//     theMaxWeight / theDelta + 3 ,     .
+//       (. thread_pool.h),       .
+//    ParallelBfs,     MinNodesPerThread      ,
+//    2 * MinNodesPerThread     .
+//      (. GetDistance)   .
+template <class WeightType>
+class DeltaStepping
+{
+public:
+	typedef uint32_t NodeId; //  
+
+	static constexpr size_t MinNodesPerThread = 16384; //        
+
+	// . theThreadCount -    (0 -   ,   
+	//    MinNodesPerThread  ).
+	explicit DeltaStepping(size_t theThreadCount = 0) : myThreadCount(theThreadCount) {}
+
+	//      :      ,
+	//     .
+	static WeightType GetInfiniteWeight();
+
+	//      theSourceId         theIdBound.
+	// theForEachEdge(anId, aFunction)   aFunction(aNeighborId, aWeight)      anId;
+	//      . theDelta -   ( ),
+	// theMaxWeight -    .
+	template <class ForEachEdge>
+	void Run(NodeId theSourceId, size_t theIdBound, ForEachEdge theForEachEdge, WeightType theDelta, WeightType theMaxWeight);
+
+	//     ,    (GetInfiniteWeight   ).
+	WeightType GetDistance(NodeId theId) const { return myDistances[theId].load(std::memory_order_relaxed); }
+
+private:
+	//       theDistance,    .
+	//  true,   .
+	bool relax(NodeId theId, WeightType theDistance);
+
+private:
+	static constexpr size_t ChunkSize = 256; //   ,     
+
+	size_t myThreadCount;                             //    (0 -   )
+	std::vector<std::atomic<WeightType>> myDistances; //    
+};
+
+//=========================================================
+// Function : GetInfiniteWeight
+// Purpose  :    
+//=========================================================
+template <class WeightType>
+WeightType DeltaStepping<WeightType>::GetInfiniteWeight()
+{
+	return std::numeric_limits<WeightType>::has_infinity ? std::numeric_limits<WeightType>::infinity()
+	                                                     : std::numeric_limits<WeightType>::max();
+}
+
+//=========================================================
+// Function : Run
+// Purpose  :    
+//=========================================================
+template <class WeightType>
+template <class ForEachEdge>
+void DeltaStepping<WeightType>::Run(NodeId theSourceId, size_t theIdBound, ForEachEdge theForEachEdge,
+                                    WeightType theDelta, WeightType theMaxWeight)
+{
+	myDistances = std::vector<std::atomic<WeightType>>(theIdBound);
+	for (std::atomic<WeightType>& aDistance : myDistances)
+	{
+		aDistance.store(GetInfiniteWeight(), std::memory_order_relaxed);
+	}
+	myDistances[theSourceId].store(WeightType(), std::memory_order_relaxed);
+	const size_t aThreadCount = myThreadCount != 0 ? myThreadCount
+		: std::max<size_t>(1, std::min(ThreadPool::GetDefaultThreadCount(), theIdBound / MinNodesPerThread));
+
+	//     ,      i       i,
+	//      i + theMaxWeight / theDelta + 1 (   -   ).
+	const size_t aBucketCount = static_cast<size_t>(theMaxWeight / theDelta) + 3;
+	auto aBucketOf = [this, theDelta](NodeId theId)
+	{
+		return static_cast<size_t>(myDistances[theId].load(std::memory_order_relaxed) / theDelta);
+	};
+
+	std::vector<std::vector<NodeId>> aBuckets(aBucketCount); //  ( i   aBuckets[i % aBucketCount])
+	std::vector<std::vector<NodeId>> aLocalNexts(aThreadCount); //     (   )
+	std::vector<NodeId> aFrontier;   //   
+	std::vector<NodeId> aSettled;    // ,     (   )
+	std::vector<uint32_t> aMarks(theIdBound, 0); //   ,     (  )
+	uint32_t aMark = 0;
+	size_t aBucket = 0;              //   
+	bool anIsLightStep = true;       //  ,     
+	bool anIsFinished = false;
+	std::atomic<size_t> aNextChunk(0);
+
+	//      aFrontier. ,       
+	// (     ),   .
+	auto aTakeBucket = [&](size_t theBucket)
+	{
+		std::vector<NodeId>& aBucketNodes = aBuckets[theBucket % aBucketCount];
+		aFrontier.clear();
+		++aMark;
+		for (NodeId anId : aBucketNodes)
+		{
+			if (aBucketOf(anId) == theBucket && aMarks[anId] != aMark)
+			{
+				aMarks[anId] = aMark;
+				aFrontier.push_back(anId);
+			}
+		}
+		aBucketNodes.clear();
+		return !aFrontier.empty();
+	};
+
+	//      (    ).
+	auto aNextStep = [&]()
+	{
+		if (anIsLightStep && aTakeBucket(aBucket))
+		{
+			aSettled.insert(aSettled.end(), aFrontier.begin(), aFrontier.end());
+			return;
+		}
+		if (anIsLightStep)
+		{
+			//   -       (   )
+			aFrontier.clear();
+			++aMark;
+			for (NodeId anId : aSettled)
+			{
+				if (aMarks[anId] != aMark)
+				{
+					aMarks[anId] = aMark;
+					aFrontier.push_back(anId);
+				}
+			}
+			aSettled.clear();
+			anIsLightStep = false;
+			return;
+		}
+
+		//     (  :      )
+		anIsLightStep = true;
+		for (size_t i = 0; i < aBucketCount; ++i)
+		{
+			if (aTakeBucket(aBucket + i))
+			{
+				aBucket += i;
+				aSettled.assign(aFrontier.begin(), aFrontier.end());
+				return;
+			}
+		}
+		anIsFinished = true;
+	};
+
+	aBuckets[0].push_back(theSourceId);
+	aNextStep();
+
+	ThreadBarrier aBarrier(aThreadCount);
+	auto aWork = [&](size_t theThreadIndex)
+	{
+		std::vector<NodeId>& aLocalNext = aLocalNexts[theThreadIndex];
+		while (true)
+		{
+			//      
+			for (size_t aChunk = aNextChunk++; aChunk * ChunkSize < aFrontier.size(); aChunk = aNextChunk++)
+			{
+				const size_t anEnd = std::min(aFrontier.size(), (aChunk + 1) * ChunkSize);
+				for (size_t i = aChunk * ChunkSize; i < anEnd; ++i)
+				{
+					const NodeId anId = aFrontier[i];
+					const WeightType aDistance = myDistances[anId].load(std::memory_order_relaxed);
+					theForEachEdge(anId, [&](NodeId aNeighborId, WeightType aWeight)
+					{
+						if ((aWeight <= theDelta) == anIsLightStep && relax(aNeighborId, aDistance + aWeight))
+						{
+							aLocalNext.push_back(aNeighborId);
+						}
+					});
+				}
+			}
+			aBarrier.Wait();
+
+			//         (  ,    )
+			if (theThreadIndex == 0)
+			{
+				for (std::vector<NodeId>& aBuffer : aLocalNexts)
+				{
+					for (NodeId anId : aBuffer)
+					{
+						aBuckets[aBucketOf(anId) % aBucketCount].push_back(anId);
+					}
+					aBuffer.clear();
+				}
+				aNextChunk = 0;
+				aNextStep();
+			}
+			aBarrier.Wait();
+
+			if (anIsFinished)
+				return;
+		}
+	};
+
+	GetThreadPool().Run(aThreadCount, aWork, &aBarrier); //   -    
+}
+
+//=========================================================
+// Function : relax
+// Purpose  :    
+//=========================================================
+template <class WeightType>
+bool DeltaStepping<WeightType>::relax(NodeId theId, WeightType theDistance)
+{
+	WeightType aCurrent = myDistances[theId].load(std::memory_order_relaxed);
+	while (theDistance < aCurrent)
+	{
+		if (myDistances[theId].compare_exchange_weak(aCurrent, theDistance, std::memory_order_relaxed))
+		{
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <memory_resource>
+
+//    (union-find)   0, 1, 2, ...
+//         ,   
+//      .
+//     .      ( ,
+//       )    O(log N),
+//        .
+class DisjointSets
+{
+public:
+	typedef uint32_t ElementId; //  (,   )
+
+	explicit DisjointSets(std::pmr::memory_resource* theMemoryResource = std::pmr::get_default_resource());
+
+	//    0 .. theElementCount - 1   (  ).
+	void Reset(size_t theElementCount);
+
+	//          .
+	ElementId AddElement();
+
+	//    .
+	size_t GetElementCount() const { return myParents.size(); }
+
+	//    ,    .   .
+	ElementId Find(ElementId theElement) const;
+
+	//   ,    .
+	//  true,      .
+	bool Unite(ElementId theFirstElement, ElementId theSecondElement);
+
+private:
+	//    ,    ,     .
+	ElementId findAndCompress(ElementId theElement);
+
+private:
+	std::pmr::vector<ElementId> myParents; //      (  -  )
+	std::pmr::vector<uint32_t> mySizes;    //   (    )
+};
+
+//=========================================================
+// Function : DisjointSets
+// Purpose  : 
+//=========================================================
+inline DisjointSets::DisjointSets(std::pmr::memory_resource* theMemoryResource)
+	: myParents(theMemoryResource),
+	  mySizes(theMemoryResource)
+{
+}
+
+//=========================================================
+// Function : Reset
+// Purpose  :     
+//=========================================================
+inline void DisjointSets::Reset(size_t theElementCount)
+{
+	myParents.resize(theElementCount);
+	for (size_t i = 0; i < theElementCount; ++i)
+	{
+		myParents[i] = static_cast<ElementId>(i);
+	}
+	mySizes.assign(theElementCount, 1);
+}
+
+//=========================================================
+// Function : AddElement
+// Purpose  :   
+//=========================================================
+inline DisjointSets::ElementId DisjointSets::AddElement()
+{
+	const ElementId anElement = static_cast<ElementId>(myParents.size());
+	myParents.push_back(anElement);
+	mySizes.push_back(1);
+	return anElement;
+}
+
+//=========================================================
+// Function : Find
+// Purpose  :   
+//=========================================================
+inline DisjointSets::ElementId DisjointSets::Find(ElementId theElement) const
+{
+	while (myParents[theElement] != theElement)
+	{
+		theElement = myParents[theElement];
+	}
+	return theElement;
+}
+
+//=========================================================
+// Function : findAndCompress
+// Purpose  :      
+//=========================================================
+inline DisjointSets::ElementId DisjointSets::findAndCompress(ElementId theElement)
+{
+	//    :       ""
+	while (myParents[theElement] != theElement)
+	{
+		myParents[theElement] = myParents[myParents[theElement]];
+		theElement = myParents[theElement];
+	}
+	return theElement;
+}
+
+//=========================================================
+// Function : Unite
+// Purpose  :  
+//=========================================================
+inline bool DisjointSets::Unite(ElementId theFirstElement, ElementId theSecondElement)
+{
+	ElementId aFirstRoot = findAndCompress(theFirstElement);
+	ElementId aSecondRoot = findAndCompress(theSecondElement);
+	if (aFirstRoot == aSecondRoot)
+	{
+		return false;
+	}
+
+	//     ,     
+	if (mySizes[aFirstRoot] < mySizes[aSecondRoot])
+	{
+		std::swap(aFirstRoot, aSecondRoot);
+	}
+	myParents[aSecondRoot] = aFirstRoot;
+	mySizes[aFirstRoot] += mySizes[aSecondRoot];
+	return true;
+}
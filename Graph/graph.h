@@ -5,18 +5,73 @@
 #include <list>
 #include <utility>
 #include <vector>
-#include <queue>
 #include <algorithm>
+#include <iterator>
 #include <exception>
+#include <stdexcept>
+#include <cstdint>
+#include <memory_resource>
+#include <atomic>
+#include <limits>
+#include <type_traits>
+
+#include "node_index.h"
+#include "traversal_workspace.h"
+#include "strong_components.h"
+#include "disjoint_sets.h"
+#include "outdated_flag.h"
+#include "reachability_index.h"
+#include "multi_source_bfs.h"
+#include "parallel_bfs.h"
+#include "pairing_heap.h"
+#include "delta_stepping.h"
+#include "parallel_radix_sort.h"
+#include "thread_pool.h"
+
+//   (. csr_graph.h  bit_matrix_graph.h)
+template <class NodeType>
+class CsrGraph;
+template <class NodeType>
+class BitMatrixGraph;
+
+//      ( WeightType  Graph  ).
+//      .
+struct Unweighted
+{
+};
 
 //  ,       .
 //      .
-template <class NodeType>
+//         ( ).
+//  ,          ,
+//    NodeType      .
+//  NodeIndex     (. node_index.h):
+// - OrderedNodeIndex ( ) -    O(log V),     ;
+// - FlatHashNodeIndex - -   ,      O(1),
+//         .
+//     (   )  
+//    std::pmr::memory_resource,   . ,  ,
+//        ,   std::pmr::monotonic_buffer_resource:
+//           .
+//  -      (. traversal_workspace.h)    
+// (. pairing_heap.h):       ,     .
+//   (. SetReachabilityIndexEnabled),   (. TraversalPolicy::Parallel)  
+//  GetStrongComponents      .
+//      ,    :   std::string
+//        .     std::pmr::polymorphic_allocator
+// (, std::pmr::string)              .
+//  WeightType    .   (Unweighted)  .
+//    (WeightType -  )     ,
+//   :       ,       ,
+//              .
+//     .
+template <class NodeType, class NodeIndex = OrderedNodeIndex<NodeType>, class WeightType = Unweighted>
 class Graph
 {
 public:
 	Graph();
-	Graph(const Graph&);
+	explicit Graph(std::pmr::memory_resource* theMemoryResource); // ,    theMemoryResource
+	Graph(const Graph&); //         (std::pmr::get_default_resource)
 	Graph& operator=(const Graph&);
 	~Graph();
 
@@ -25,32 +80,115 @@ public:
 	                                            //    -  ).
 	                                            //          .
 	typedef std::list<Edge> EdgeList; //  .
+	typedef std::pair<Edge, WeightType> WeightedEdge; //    
+	typedef std::list<WeightedEdge> WeightedEdgeList; //    .
+
+	static constexpr bool IsWeighted = !std::is_same<WeightType, Unweighted>::value; //   
 	
-	typedef std::map<NodeType, NodeList> GraphMap; //  ,     
+	typedef std::map<NodeType, NodeList> GraphMap; //  ,     
+
+	typedef uint32_t NodeId; //   (. GetNodeId)
+
+	typedef uint32_t Distance; //    (  )
+	static constexpr Distance InfiniteDistance = 0xFFFFFFFF; //    
 
 	//         .
 	// -    IncorrectGraphException,     ,
 	//    -       
 	//  (,   {A, B}  {(A, B), (B, C)})  ,    (B, C)   C,      {A, B}
 	// -        (,       ).
+	// -      WeightType().
+	// -      (. SetTopologicalOrderTrackingEnabled)  
+	//    IncorrectGraphException,     ;    .
 	void Build(const NodeList& theNodeList, const EdgeList& theEdgeList);
 
+	//          .        .
+	//    IncorrectGraphException,   -  .
+	//      ,   Build(theNodeList, {})     .
+	template <class Weight = WeightType, class = typename std::enable_if<!std::is_same<Weight, Unweighted>::value>::type>
+	void Build(const NodeList& theNodeList, const WeightedEdgeList& theEdgeList);
+
+	//         (, ,     
+	//   )  ,   ,    :  
+	//   .
+	//    -  (Edge) ,   ,    (WeightedEdge).
+	//  ,   ,   -rvalue,    (,
+	// ),   ,   .   (, std::span) ,
+	//      rvalue: ,    ,  .
+	//       ,         .
+	//   :        
+	//    ,  ,        (. BuildParallel).
+	template <class NodeRange, class EdgeRange>
+	void Build(NodeRange&& theNodes, EdgeRange&& theEdges);
+
+	//  ,  Build  ,          theThreadCount 
+	//  (0 -   , . parallel_radix_sort.h).    ,     
+	//   (,  );          .
+	//         .    :
+	//       .
+	template <class NodeRange, class EdgeRange>
+	void BuildParallel(NodeRange&& theNodes, EdgeRange&& theEdges, size_t theThreadCount = 0);
+
 	//    theNode  .       theNode,   .
 	//  true,    .   false.
 	bool AddNode(const NodeType& theNode);
 
+	//     :    .
+	bool AddNode(NodeType&& theNode);
+
+	//       theNodes (, ),     .
+	//    .        .
+	template <class NodeRange>
+	size_t AddNodes(const NodeRange& theNodes);
+
 	//    theNode  .       theEdge,   .
 	//  true,    .   false.
 	//           -    IncorrectGraphException.
+	//      (. SetTopologicalOrderTrackingEnabled) 
+	//  IncorrectGraphException    ,     .
+	//      WeightType().
 	bool AddEdge(const Edge& theEdge);
 
+	//      theWeight   .       theEdge,
+	//     theWeight   false.
+	//          ,       
+	//      -   IncorrectGraphException.
+	bool AddEdge(const Edge& theEdge, const WeightType& theWeight);
+
+	//       theEdges (, ).   -  (Edge)
+	// ,   ,    (WeightedEdge);       
+	//  ,   AddEdge (         ).
+	//    .
+	//      ,            
+	//   ,    K    O(K log K +    ),
+	//    O(K * d),      .
+	//  -         ,    IncorrectGraphException
+	//    .      (. SetTopologicalOrderTrackingEnabled)
+	//    ,   - ,  ,      .
+	template <class EdgeRange>
+	size_t AddEdges(const EdgeRange& theEdges);
+
+	//      .
+	//   std::invalid_argument,     .
+	const WeightType& GetEdgeWeight(const Edge& theEdge) const;
+
 	//     
 	void Clear();
 
 	//      ,    .    ,    ,   .
 	//  true,    .   false.
+	//     (. SetReverseIndexEnabled),     
+	// ,       .       .
 	bool RemoveNode(const NodeType& theNode);
 
+	//     theNodes (, )   ,   .
+	// ,    , .    .
+	//             (     ,
+	//     ).    ,     
+	// ,       .
+	template <class NodeRange>
+	size_t RemoveNodes(const NodeRange& theNodes);
+
 	//     .    ,    ,   .
 	//  true,    .   false.
 	bool RemoveEdge(const Edge& theEdge);
@@ -61,13 +199,18 @@ public:
 	//   ,     .   .
 	bool ContainsEdge(const Edge& theEdge) const;
 
+	//     .
+	size_t GetNodeCount() const { return myNodeIndex.GetSize(); }
+
+	//     .
+	size_t GetEdgeCount() const { return myEdgeCount; }
+
 	//          .
-	friend std::ostream& operator<<(std::ostream& theOut, const Graph<NodeType>& theGraph)
+	friend std::ostream& operator<<(std::ostream& theOut, const Graph& theGraph)
 	{
-		for (const auto& aKeyValue : theGraph.myAdjacencyMap)
+		theGraph.myNodeIndex.ForEach(theGraph.myNodes, [&theOut, &theGraph](const NodeType& aKey, NodeId anId)
 		{
-			const NodeType& aKey = aKeyValue.first;
-			const Graph<NodeType>::NodeList& aNodeList = aKeyValue.second;
+			const NodeList aNodeList = theGraph.getSortedNodeList(anId);
 
 			theOut << aKey << " : {";
 			bool aFirstElementWasPrinted = false;
@@ -84,7 +227,7 @@ public:
 				}
 			}
 			theOut << " }" << std::endl;
-		}
+		});
 		return theOut;
 	}
 
@@ -112,8 +255,29 @@ public:
 
 	//   true,     (           ).
 	//   false.
+	//   O(V + E):      ,       
+	//       ,           .
+	//       ,    (. SetReverseIndexEnabled),
+	//       .
 	bool IsGraphConnected() const;
 
+	//  ,  IsGraphConnected,     thePolicy (. TraversalPolicy).
+	// TraversalPolicy::Parallel      (   , . parallel_bfs.h;
+	//   2 * ParallelBfs::MinNodesPerThread     ), 
+	// TraversalPolicy::DirectionOptimizing     (  )   TopDown.
+	bool IsGraphConnected(TraversalPolicy thePolicy) const;
+
+	//   true,      (  ,     ).
+	//   false.    ,     - .
+	//   O(V + E),       (. SetWeakComponentTrackingEnabled) -  O(1).
+	bool IsGraphWeaklyConnected() const;
+
+	//   true,        
+	// (   ,     ).
+	//   std::invalid_argument,          .
+	//   O(V + E),       -   O(1).
+	bool AreWeaklyConnected(const NodeType& theFirstNode, const NodeType& theSecondNode) const;
+
 	//   true,    theBeginNode  theEndNode  .
 	//   false.
 	//   std::invalid_argument,          .
@@ -121,13 +285,191 @@ public:
 	//                       .
 	//  2:     .     true,      ;
 	//                 ,   .
+	//  3:       (GetThreadTraversalWorkspace)
+	//                  ,           .
+	//  4:     (. SetReachabilityIndexEnabled)   ,   .
 	bool ExistsPathBetweenTwoNodes(const NodeType& theBeginNode, const NodeType& theEndNode) const;
 
-	//     std::map,     .
-	const GraphMap& GetAdjacencyMap() const { return myAdjacencyMap; }
+	//  ,  ExistsPathBetweenTwoNodes,      .
+	bool ExistsPathBetweenTwoNodes(const NodeType& theBeginNode, const NodeType& theEndNode, TraversalWorkspace& theWorkspace) const;
+
+	//  ,  ExistsPathBetweenTwoNodes,     thePolicy (. TraversalPolicy).
+	// TraversalPolicy::DirectionOptimizing     ,    
+	//       ,  ,    .    
+	//     (, )      .
+	//      :    (. SetReverseIndexEnabled),   
+	// ,            O(V + E).
+	// TraversalPolicy::Parallel        (   , . parallel_bfs.h);
+	//       :        ,
+	//    2 * ParallelBfs::MinNodesPerThread     .
+	bool ExistsPathBetweenTwoNodes(const NodeType& theBeginNode, const NodeType& theEndNode, TraversalPolicy thePolicy) const;
+
+	//    (  )    theBeginNode   theEndNode:
+	//    theBeginNode  theEndNode .   ,   .
+	//    ExistsPathBetweenTwoNodes,      :    
+	//     (  - {A, A}).
+	//   std::invalid_argument,          .
+	//    ,    theEndNode;   
+	//        (. TraversalWorkspace::SetParent).
+	NodeList ShortestPath(const NodeType& theBeginNode, const NodeType& theEndNode) const;
+
+	//  ,  ShortestPath,      theBeginNode     theEndNode  
+	// (     )  .       
+	//       ,  .
+	//       (. SetReverseIndexEnabled);   ,
+	//        O(V + E),   .
+	NodeList ShortestPathBidirectional(const NodeType& theBeginNode, const NodeType& theEndNode) const;
+
+	//    (   )   theSource    
+	//      O(V + E).     (. GetNodeId)
+	//    GetNodeIdBound();     ,   ,
+	//    InfiniteDistance.   theSource     0.
+	//   std::invalid_argument,      theSource.
+	std::vector<Distance> Distances(const NodeType& theSource) const;
 
-	//    .
-	bool operator==(const Graph& theGraph) const { return myAdjacencyMap == theGraph.myAdjacencyMap; }
+	//    (    )   theSource     .
+	//     (. GetNodeId)    GetNodeIdBound();   
+	//  ,   ,    GetInfiniteWeight().   theSource     0.
+	// TraversalPolicy::Parallel    delta-stepping (. delta_stepping.h,   
+	//  ;   2 * DeltaStepping::MinNodesPerThread     ),
+	//   -      (. pairing_heap.h)  O(E + V log V).
+	//   std::invalid_argument,      theSource.
+	std::vector<WeightType> WeightedDistances(const NodeType& theSource, TraversalPolicy thePolicy = TraversalPolicy::TopDown) const;
+
+	//           theBeginNode   theEndNode  
+	// ( , ,      theEndNode).
+	//    ShortestPath,         ,   .
+	//   std::invalid_argument,          .
+	NodeList WeightedShortestPath(const NodeType& theBeginNode, const NodeType& theEndNode) const;
+
+	//        :   
+	//   ,     .
+	static WeightType GetInfiniteWeight() { return DeltaStepping<WeightType>::GetInfiniteWeight(); }
+
+	//      ExistsPathBetweenTwoNodes:  i  
+	// ExistsPathBetweenTwoNodes(theQueries[i].first, theQueries[i].second).
+	//     ,     64    
+	//  (. VisitFromSources),         64  .
+	//   64        (. thread_pool.h;    ,
+	//    ,    -   ).     ,
+	//    ,     .
+	//     (. SetReachabilityIndexEnabled)    .
+	//   std::invalid_argument,          
+	// (  ).
+	std::vector<bool> ExistsPaths(const std::vector<std::pair<NodeType, NodeType>>& theQueries) const;
+
+	//         theSourceIds (  MultiSourceBfs::LaneCount,
+	// . multi_source_bfs.h):  theSourceIds[i]   i  .
+	//      ,      - ,
+	//  theOnVisit(anId, aNewLanes, aLevel),  aLevel -    (  1).
+	//         ,   64.
+	//   std::invalid_argument,    MultiSourceBfs::LaneCount
+	//  -     .
+	//        (GetThreadMultiSourceBfs).
+	template <class OnVisit>
+	void VisitFromSources(const std::vector<NodeId>& theSourceIds, OnVisit theOnVisit) const;
+
+	//       (    ,    ,
+	//  ,  )    O(V + E)   true.
+	//     (   ),   :   false,   theCycle
+	//   -    ,      ( ShortestPath(A, A)).
+	//      (. SetTopologicalOrderTrackingEnabled)
+	//      O(V).
+	bool TopologicalOrder(NodeList& theOrder, NodeList& theCycle) const;
+
+	//     .
+	bool TopologicalOrder(NodeList& theOrder) const;
+
+	//   true,     (   ).
+	//             .
+	bool HasCycle() const;
+
+	//         (. strong_components.h).
+	//       (. GetNodeId).
+	//   O(V + E)  .
+	StrongComponents GetStrongComponents() const;
+
+	//    :  -     (. GetStrongComponents),
+	//  -  ,     .     .
+	Graph<StrongComponents::ComponentId> GetCondensation() const;
+
+	//    .
+	//   std::invalid_argument,     .
+	//   ,     ;   
+	//    ,  .    GetNodeIdBound().
+	NodeId GetNodeId(const NodeType& theNode) const;
+
+	//     .       (. IsNodeIdUsed).
+	const NodeType& GetNode(NodeId theId) const { return myNodes[theId]; }
+
+	//       ( ,  ).
+	size_t GetNodeIdBound() const { return myNodes.size(); }
+
+	//   true,     .
+	bool IsNodeIdUsed(NodeId theId) const { return theId < myIsIdUsed.size() && myIsIdUsed[theId]; }
+
+	//   std::map,     .
+	//      .
+	//       O(V + E log E),       ,
+	//      (    ).
+	GraphMap GetAdjacencyMap() const;
+
+	//       -  ,       .
+	//          O(V + E),   .
+	//     Build, AddEdge, RemoveEdge  RemoveNode
+	//          .
+	void SetReverseIndexEnabled(bool theIsEnabled);
+
+	//   true,    .
+	bool IsReverseIndexEnabled() const { return myIsReverseIndexEnabled; }
+
+	//           
+	// (. disjoint_sets.h).   IsGraphWeaklyConnected  AreWeaklyConnected.
+	// Build, AddNode  AddEdge     O(1)    .
+	// RemoveNode  RemoveEdge    ,     :
+	//    O(V + E)   .    ,    .
+	//    ,      
+	//      (   ) .
+	void SetWeakComponentTrackingEnabled(bool theIsEnabled);
+
+	//   true,      .
+	bool IsWeakComponentTrackingEnabled() const { return myIsWeakComponentTrackingEnabled; }
+
+	//       (. reachability_index.h),  ExistsPathBetweenTwoNodes
+	//      .    O(V + E) ( O(C * E / 64)  
+	//     C)        .
+	//       (  ),   (A, B) -  
+	//   A  B  ; Build  , RemoveEdge  RemoveNode    .
+	//    ,   ,   .
+	//    ,      
+	//      (   ) .
+	void SetReachabilityIndexEnabled(bool theIsEnabled);
+
+	//   true,    .
+	bool IsReachabilityIndexEnabled() const { return myIsReachabilityIndexEnabled; }
+
+	//         (. TopologicalOrder).
+	//      O(V + E);    ,   
+	// IncorrectGraphException,    .
+	//   ,    : AddEdge  ,  ,
+	//      (A, B),  B   A,    - :
+	//   ,   B,  ,    A,     B  A.
+	// ,    A,    ,    (. SetReverseIndexEnabled),
+	//    ,   B  A.       ,
+	//   ( )         .
+	void SetTopologicalOrderTrackingEnabled(bool theIsEnabled);
+
+	//   true,     .
+	bool IsTopologicalOrderTrackingEnabled() const { return myIsTopologicalOrderTrackingEnabled; }
+
+	//    ,     .
+	std::pmr::memory_resource* GetMemoryResource() const { return myNodes.get_allocator().resource(); }
+
+	//    .  ,       ;   ,
+	//   ,  ,   .       :
+	//         ,     
+	//    O(V log V + E) (  ,     -).
+	bool operator==(const Graph& theGraph) const;
 	bool operator!=(const Graph& theGraph) const { return !(*this == theGraph); }
 
 public:
@@ -139,335 +481,3008 @@ public:
 	};
 
 private:
-	//          .
-	// ,  map:
-	// A - {B, C, D, C}
-	// B - {A, D, D}
-	//  :
-	// A - {B, C, D}
-	// B - {A, D}
-	void deleteDuplicatesInAdjacencyLists();
-	
+	typedef std::pmr::vector<NodeId> IdList; //     (   )
+	typedef std::pmr::vector<WeightType> WeightList; //       
+
+	//   AddEdges
+	struct PendingEdge
+	{
+		NodeId myBeginId;
+		NodeId myEndId;
+		WeightType myWeight;
+		bool myIsAdded; //  ,       ( mergeEdges)
+	};
+
+	//   ,     ,   ,    AddEdges.
+	static const Edge& edgeOf(const Edge& theEdge) { return theEdge; }
+	static const Edge& edgeOf(const WeightedEdge& theEdge) { return theEdge.first; }
+	static WeightType weightOf(const Edge&) { return WeightType(); }
+	static const WeightType& weightOf(const WeightedEdge& theEdge) { return theEdge.second; }
+	//    ,           .
+	static std::false_type isWeightGiven(const Edge&) { return {}; }
+	static std::true_type isWeightGiven(const WeightedEdge&) { return {}; }
+
+	//     theEdges[theFirst .. theLast) ( ,     )
+	//          . ,     ,  myIsAdded;
+	//    ,   theIsWeightReplaced .    .
+	size_t mergeEdges(std::pmr::vector<PendingEdge>& theEdges, size_t theFirst, size_t theLast, bool theIsWeightReplaced);
+
+	//     ,    ,   
+	// (   ),  0.
+	template <class Range>
+	static size_t getRangeSize(Range& theRange);
+
+	//  ,   :    (   )
+	//     .   (, std::span)   .
+	template <class Range, class = void>
+	struct IsOwningRange : std::false_type {};
+	template <class Range>
+	struct IsOwningRange<Range, std::void_t<decltype(*std::begin(std::declval<const Range&>()))>>
+		: std::is_const<std::remove_reference_t<decltype(*std::begin(std::declval<const Range&>()))>> {};
+
+	//         (. Build)  theThreadCount  (. BuildParallel).
+	template <class NodeRange, class EdgeRange>
+	void buildFromRanges(NodeRange&& theNodes, EdgeRange&& theEdges, size_t theThreadCount);
+
+	//    :   (   32 ,  -  )  
+	typedef typename std::conditional<IsWeighted, std::pair<uint64_t, WeightType>, uint64_t>::type SortedEdge;
+
+	//        .
+	static uint64_t sortKeyOf(const SortedEdge& theEdge)
+	{
+		if constexpr (IsWeighted)
+			return theEdge.first;
+		else
+			return theEdge;
+	}
+
+	//      theEdge (  Build)     theSortedEdge.
+	//  false,  -         .
+	template <class EdgeElement>
+	bool resolveEdge(const EdgeElement& theEdge, SortedEdge& theSortedEdge) const;
+
+	//    IncorrectGraphException     ,   resolveEdge  false.
+	template <class EdgeElement>
+	void throwEdgeError(const EdgeElement& theEdge) const;
+
+	//       :     (. BuildParallel),
+	//      ,   (     )
+	//       .   ,     .
+	//  true,    .
+	template <class EdgeRange>
+	bool loadEdges(EdgeRange&& theEdges, size_t theThreadCount);
+
+	//     theCount  .
+	void reserveNodes(size_t theCount);
+
+	//       theBeginId   ,   theIsRemoved.
+	//    .
+	size_t eraseMarkedEdges(NodeId theBeginId, const std::pmr::vector<char>& theIsRemoved);
+
+	//      loadEdges:      .
+	void finishBuild(bool theHasEdges);
+
+	//    (. AddEdge).    ,   ,   theIsWeightReplaced .
+	bool addEdge(const Edge& theEdge, const WeightType& theWeight, bool theIsWeightReplaced);
+
+	//         theBeginId   .
+	//    ,   ,   theIsWeightReplaced .  true,    .
+	bool insertEdge(NodeId theBeginId, NodeId theEndId, const WeightType& theWeight, bool theIsWeightReplaced);
+
+	//         theBeginId   .
+	//  true,     .
+	bool eraseEdge(NodeId theBeginId, NodeId theEndId);
+
+	//    IncorrectGraphException,   .
+	static void checkWeight(const WeightType& theWeight);
+
+	//      ,     .
+	//  true,    .
+	static bool insertSorted(IdList& theIdList, NodeId theId);
+
+	//      .
+	//  true,     .
+	static bool eraseSorted(IdList& theIdList, NodeId theId);
+
+	//       .
+	void rebuildReverseIndex();
+
+	//          theSets.
+	//   .
+	size_t buildWeakComponents(DisjointSets& theSets) const;
+
+	//      ,   .
+	//      :      .
+	void updateWeakComponents() const;
+
+	//    ,   .
+	//      :      .
+	void updateReachabilityIndex() const;
+
+	//           theOrderIds.
+	//  false,    . ,   ,     .
+	bool sortTopologically(std::pmr::vector<NodeId>& theOrderIds) const;
+
+	//      .
+	//  false (   ),    .
+	bool rebuildTopologicalOrder();
+
+	//         (theBeginId, theEndId)
+	// (  - ).  false    ,     .
+	bool updateTopologicalOrder(NodeId theBeginId, NodeId theEndId);
+
+	//       :  ,    anId,
+	//   theSources[theOffsets[anId] .. theOffsets[anId + 1]).
+	void buildTransposedAdjacency(std::pmr::vector<size_t>& theOffsets, std::pmr::vector<NodeId>& theSources) const;
+
+	//    -  .     .
+	NodeId getAnyNodeId() const;
+
+	//    theIds       .
+	//  ,         .
+	void getIdsInNodeOrder(std::vector<NodeId>& theIds) const;
+
+	//        theRootId      (  theRootId).
+	// theForEachNeighbor(anId, aFunction)   aFunction(aNeighborId)     anId.
+	template <class ForEachNeighbor>
+	size_t countReachableNodes(NodeId theRootId, ForEachNeighbor theForEachNeighbor, TraversalWorkspace& theWorkspace) const;
+
+	//    .  false,     .
+	bool findNodeId(const NodeType& theNode, NodeId& theId) const;
+
+	//      (     ).
+	//     ,    .
+	template <class Node>
+	NodeId internNode(Node&& theNode);
+
+	//    ,    theId,    .
+	NodeList getSortedNodeList(NodeId theId) const;
+
+	//   true,    theBeginId   theEndId       .
+	//     theWorkspace.
+	bool existsPath(NodeId theBeginId, NodeId theEndId, TraversalWorkspace& theWorkspace) const;
+
+	//    ,  existsPath,     (. TraversalPolicy::DirectionOptimizing).
+	bool existsPathDirectionOptimizing(NodeId theBeginId, NodeId theEndId, TraversalWorkspace& theWorkspace) const;
+
+	//      theWorkspace  ,     theBeginId       
+	// ( theBeginId ,      ).
+	void visitReachableNodes(NodeId theBeginId, TraversalWorkspace& theWorkspace) const;
+
+	//              .
+	template <class> friend class CsrGraph;
+	template <class> friend class BitMatrixGraph;
+
 private:
-	GraphMap myAdjacencyMap;
+	NodeIndex myNodeIndex;                //  :  -> 
+	std::pmr::vector<NodeType> myNodes;   //  -> 
+	std::pmr::vector<IdList> myAdjacency; //   ( -   ).
+	                                      //       ,
+	                                      //  ,       .
+	std::pmr::vector<WeightList> myWeights; //   ( -   ).    .
+	std::pmr::vector<NodeId> myFreeIds;   //   ,    
+	std::pmr::vector<char> myIsIdUsed;    //  ,     
+	size_t myEdgeCount = 0;               //  
+
+	bool myIsReverseIndexEnabled = false; //  ,    
+	std::pmr::vector<IdList> myReverseAdjacency; //  :   ,    ( -   ).
+	                                        // ,    .
+
+	bool myIsWeakComponentTrackingEnabled = false; //  ,     
+	mutable DisjointSets myWeakComponents;         //    ( -  ).
+	                                               // ,   .
+	mutable size_t myWeakComponentCount = 0;       //    
+	mutable OutdatedFlag myWeakComponentsOutdated; //  ,         
+
+	bool myIsReachabilityIndexEnabled = false;          //  ,    
+	mutable ReachabilityIndex myReachabilityIndex;      //   (,  )
+	mutable OutdatedFlag myReachabilityIndexOutdated;   //  ,      
+
+	bool myIsTopologicalOrderTrackingEnabled = false;      //  ,    
+	std::pmr::vector<uint32_t> myTopologicalPositions;     //      ( -  )
+	std::pmr::vector<NodeId> myTopologicalOrderIds;        //     . ,  
+	                                                       // .     .
 };
 
 //=========================================================
 // Function : Graph
 // Purpose  : Default constructor
 //=========================================================
-template <class NodeType>
-Graph<NodeType>::Graph() = default;
+template <class NodeType, class NodeIndex, class WeightType>
+Graph<NodeType, NodeIndex, WeightType>::Graph() : Graph(std::pmr::get_default_resource())
+{
+}
+
+//=========================================================
+// Function : Graph
+// Purpose  :  ,    theMemoryResource
+//=========================================================
+template <class NodeType, class NodeIndex, class WeightType>
+Graph<NodeType, NodeIndex, WeightType>::Graph(std::pmr::memory_resource* theMemoryResource)
+	: myNodeIndex(theMemoryResource),
+	  myNodes(theMemoryResource),
+	  myAdjacency(theMemoryResource),
+	  myWeights(theMemoryResource),
+	  myFreeIds(theMemoryResource),
+	  myIsIdUsed(theMemoryResource),
+	  myReverseAdjacency(theMemoryResource),
+	  myWeakComponents(theMemoryResource),
+	  myTopologicalPositions(theMemoryResource),
+	  myTopologicalOrderIds(theMemoryResource)
+{
+}
 
 //=========================================================
 // Function : Graph
 // Purpose  : Copy constructor
 //=========================================================
-template <class NodeType>
-Graph<NodeType>::Graph(const Graph<NodeType> &) = default;
+template <class NodeType, class NodeIndex, class WeightType>
+Graph<NodeType, NodeIndex, WeightType>::Graph(const Graph<NodeType, NodeIndex, WeightType> &) = default;
 
 //=========================================================
 // Function : operator=
 // Purpose  : Assignment operator
 //=========================================================
-template <class NodeType>
-Graph<NodeType>& Graph<NodeType>::operator=(const Graph<NodeType> &) = default;
+template <class NodeType, class NodeIndex, class WeightType>
+Graph<NodeType, NodeIndex, WeightType>& Graph<NodeType, NodeIndex, WeightType>::operator=(const Graph<NodeType, NodeIndex, WeightType> &) = default;
 
 //=========================================================
 // Function : ~Graph
 // Purpose  : Destructor
 //=========================================================
-template <class NodeType>
-Graph<NodeType>::~Graph() = default;
+template <class NodeType, class NodeIndex, class WeightType>
+Graph<NodeType, NodeIndex, WeightType>::~Graph() = default;
+
 
 //=========================================================
 // Function : Build
 // Purpose  :       
 //=========================================================
-template<class NodeType>
-void Graph<NodeType>::Build(const NodeList & theNodeList, const EdgeList & theEdgeList)
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::Build(const NodeList & theNodeList, const EdgeList & theEdgeList)
 {
-	for (const auto& aNode : theNodeList)
-	{
-		myAdjacencyMap[aNode]; //   std::map  
-	}
+	buildFromRanges(theNodeList, theEdgeList, 1);
+}
 
-	//     std::map
-	// (    ).
+//=========================================================
+// Function : Build
+// Purpose  :          
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+template<class Weight, class>
+void Graph<NodeType, NodeIndex, WeightType>::Build(const NodeList & theNodeList, const WeightedEdgeList & theEdgeList)
+{
 	for (const auto& anEdge : theEdgeList)
 	{
-		const auto& anEdgeBegin = anEdge.first;
-		const auto& anEdgeEnd = anEdge.second;
-
-		if (!ContainsNode(anEdgeBegin) || !ContainsNode(anEdgeEnd))
-		{
-			//       std::map
-			throw IncorrectGraphException("Incorrect Node in Edge");
-		}
-		else
-		{
-			myAdjacencyMap[anEdgeBegin].push_back(anEdgeEnd);
-		}
+		checkWeight(anEdge.second);
 	}
 
-	deleteDuplicatesInAdjacencyLists();
+	buildFromRanges(theNodeList, theEdgeList, 1);
 }
 
 //=========================================================
-// Function : AddNode
-// Purpose  :    
+// Function : Build
+// Purpose  :       
 //=========================================================
-template<class NodeType>
-bool Graph<NodeType>::AddNode(const NodeType & theNode)
+template<class NodeType, class NodeIndex, class WeightType>
+template<class NodeRange, class EdgeRange>
+void Graph<NodeType, NodeIndex, WeightType>::Build(NodeRange&& theNodes, EdgeRange&& theEdges)
 {
-	// std::map::insert - "Returns a pair consisting of an iterator to the inserted element
-	//                    (or to the element that prevented the insertion)
-	//                    and a bool denoting whether the insertion took place".
-	//    https://en.cppreference.com/w/cpp/container/map/insert
-	return myAdjacencyMap.insert({ theNode, {} }).second;
+	buildFromRanges(std::forward<NodeRange>(theNodes), std::forward<EdgeRange>(theEdges), 1);
 }
 
 //=========================================================
-// Function : AddEdge
-// Purpose  :    
+// Function : BuildParallel
+// Purpose  :          
 //=========================================================
-template<class NodeType>
-bool Graph<NodeType>::AddEdge(const Edge & theEdge)
+template<class NodeType, class NodeIndex, class WeightType>
+template<class NodeRange, class EdgeRange>
+void Graph<NodeType, NodeIndex, WeightType>::BuildParallel(NodeRange&& theNodes, EdgeRange&& theEdges, size_t theThreadCount)
 {
-	const NodeType& anEdgeBegin = theEdge.first;
-	const NodeType& anEdgeEnd = theEdge.second;
-
-	if (!ContainsNode(anEdgeBegin) || !ContainsNode(anEdgeEnd))
-	{
-		//       std::map
-		throw IncorrectGraphException("Incorrect Node in Edge");
-	}
-	else
+	if (theThreadCount == 0)
 	{
-		auto anEdgeBeginIter = myAdjacencyMap.find(anEdgeBegin);
-		const NodeList& aNodeList = anEdgeBeginIter->second; //  ,    anEdgeBegin
-		auto aFoundIter = std::find(aNodeList.cbegin(), aNodeList.cend(), anEdgeEnd);
-
-		bool aNodeIsAlreadyInList = (aFoundIter != aNodeList.cend());
-
-		if (!aNodeIsAlreadyInList)
-		{
-			myAdjacencyMap[anEdgeBegin].push_back(anEdgeEnd);
-			myAdjacencyMap[anEdgeBegin].sort();
-		}
-
-		return !aNodeIsAlreadyInList;
+		theThreadCount = ThreadPool::GetDefaultThreadCount();
 	}
+	buildFromRanges(std::forward<NodeRange>(theNodes), std::forward<EdgeRange>(theEdges), theThreadCount);
 }
 
 //=========================================================
-// Function : Clear
-// Purpose  :    
-//=========================================================
-template<class NodeType>
-void Graph<NodeType>::Clear()
-{
-	myAdjacencyMap.clear();
-}
-
-//=========================================================
-// Function : RemoveNode
-// Purpose  :    
+// Function : AddNode
+// Purpose  :    
 //=========================================================
-template<class NodeType>
-bool Graph<NodeType>::RemoveNode(const NodeType& theNode)
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::AddNode(const NodeType & theNode)
 {
-	if (!ContainsNode(theNode))
+	if (ContainsNode(theNode))
 	{
-		//     
 		return false;
 	}
-	else
-	{
-		auto aNodeIter = myAdjacencyMap.find(theNode);
-		myAdjacencyMap.erase(aNodeIter); //     
-
-		//         
-		for (auto& aKeyValue : myAdjacencyMap)
-		{
-			NodeList& aNodeList = aKeyValue.second;
-			aNodeList.remove(theNode); //    theNode   aNodeList
-		}
-
-		return true;
-	}
+	internNode(theNode);
+	return true;
 }
 
 //=========================================================
-// Function : RemoveEdge
-// Purpose  :    .
+// Function : AddNode
+// Purpose  :     
 //=========================================================
-template<class NodeType>
-bool Graph<NodeType>::RemoveEdge(const Edge& theEdge)
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::AddNode(NodeType && theNode)
 {
-	const NodeType& anEdgeBegin = theEdge.first;
-	const NodeType& anEdgeEnd = theEdge.second;
-	if (!ContainsNode(anEdgeBegin))
+	if (ContainsNode(theNode))
 	{
 		return false;
 	}
-	else
-	{
-		auto aNodeIter = myAdjacencyMap.find(anEdgeBegin);
-		NodeList& aNodeList = aNodeIter->second; //  ,   anEdgeBegin
-		auto anEdgeEndIter = std::find(aNodeList.begin(), aNodeList.end(), anEdgeEnd); //  ,   
-		if (anEdgeEndIter == aNodeList.end())
-		{
-			return false;
-		}
-		else
-		{
-			aNodeList.erase(anEdgeEndIter);
-			return true;
-		}
-	}
+	internNode(std::move(theNode));
+	return true;
 }
 
 //=========================================================
-// Function : ContainsNode
-// Purpose  : ,     
+// Function : AddNodes
+// Purpose  :     
 //=========================================================
-template<class NodeType>
-bool Graph<NodeType>::ContainsNode(const NodeType& theNode) const
+template<class NodeType, class NodeIndex, class WeightType>
+template<class NodeRange>
+size_t Graph<NodeType, NodeIndex, WeightType>::AddNodes(const NodeRange& theNodes)
 {
-	return myAdjacencyMap.find(theNode) != myAdjacencyMap.end();
-}
+	reserveNodes(getRangeSize(theNodes));
 
-//=========================================================
-// Function : ContainsEdge
-// Purpose  : ,     
-//=========================================================
-template<class NodeType>
-bool Graph<NodeType>::ContainsEdge(const Edge & theEdge) const
-{
-	const NodeType& anEdgeBegin = theEdge.first;
-	const NodeType& anEdgeEnd = theEdge.second;
-	if (ContainsNode(anEdgeBegin) && ContainsNode(anEdgeEnd))
+	size_t anAddedCount = 0;
+	for (const auto& aNode : theNodes)
 	{
-		const NodeList& aNodeList = myAdjacencyMap.at(anEdgeBegin);
-		auto aFoundIter = std::find(aNodeList.cbegin(), aNodeList.cend(), anEdgeEnd);
-		return aFoundIter != aNodeList.cend();
+		if (AddNode(aNode))
+		{
+			++anAddedCount;
+		}
 	}
-	return false;
+	return anAddedCount;
 }
 
 //=========================================================
-// Function : IsGraphConnected
-// Purpose  : ,    
+// Function : AddEdges
+// Purpose  :     
 //=========================================================
-template<class NodeType>
-bool Graph<NodeType>::IsGraphConnected() const
+template<class NodeType, class NodeIndex, class WeightType>
+template<class EdgeRange>
+size_t Graph<NodeType, NodeIndex, WeightType>::AddEdges(const EdgeRange& theEdges)
 {
-	//    ,    
-	std::vector<NodeType> aNodeVector;
-	for (const auto& aKeyValue : myAdjacencyMap)
+	size_t anAddedCount = 0;
+	if (myIsTopologicalOrderTrackingEnabled)
 	{
-		const NodeType& aNode = aKeyValue.first;
-		aNodeVector.push_back(aNode);
+		//       ,   
+		for (const auto& anEdge : theEdges)
+		{
+			if constexpr (IsWeighted)
+			{
+				if (isWeightGiven(anEdge))
+				{
+					checkWeight(weightOf(anEdge));
+				}
+			}
+			if (addEdge(edgeOf(anEdge), weightOf(anEdge), isWeightGiven(anEdge)))
+			{
+				++anAddedCount;
+			}
+		}
+		return anAddedCount;
 	}
 
-	//     
-	if (aNodeVector.size() == 0)
-		return false;
-
-	// ,    ,   
-	// (      )
-	if (aNodeVector.size() == 1)
-		return true;
-
-	//       
-	for (size_t i = 0; i < aNodeVector.size(); ++i)
+	//        .
+	std::pmr::vector<PendingEdge> anEdges(GetMemoryResource());
+	anEdges.reserve(getRangeSize(theEdges));
+	//    ,      
+	constexpr bool anIsWeightReplaced = decltype(isWeightGiven(*std::begin(theEdges)))::value;
+	for (const auto& anEdge : theEdges)
 	{
-		for (size_t j = 0; j < aNodeVector.size(); ++j)
+		NodeId aBeginId = 0;
+		NodeId anEndId = 0;
+		if (!findNodeId(edgeOf(anEdge).first, aBeginId) || !findNodeId(edgeOf(anEdge).second, anEndId))
 		{
-			if (!ExistsPathBetweenTwoNodes(aNodeVector[i], aNodeVector[j]))
+			throw IncorrectGraphException("Incorrect Node in Edge");
+		}
+		if constexpr (IsWeighted)
+		{
+			if (isWeightGiven(anEdge))
 			{
-				return false;
+				checkWeight(weightOf(anEdge));
 			}
 		}
+		anEdges.push_back(PendingEdge{ aBeginId, anEndId, weightOf(anEdge), false });
 	}
-	return true;
-}
 
-//=========================================================
-// Function : ExistsPathBetweenTwoNodes
-// Purpose  : ,      
-//=========================================================
-template<class NodeType>
-bool Graph<NodeType>::ExistsPathBetweenTwoNodes(const NodeType& theBeginNode, const NodeType& theEndNode) const
-{
-	if (!ContainsNode(theBeginNode) || !ContainsNode(theEndNode))
+	//      ;      ,
+	//       .
+	std::stable_sort(anEdges.begin(), anEdges.end(), [](const PendingEdge& theFirst, const PendingEdge& theSecond)
 	{
-		throw std::invalid_argument("Graph does not contain at least one of given nodes");
+		return theFirst.myBeginId != theSecond.myBeginId ? theFirst.myBeginId < theSecond.myBeginId
+		                                                 : theFirst.myEndId < theSecond.myEndId;
+	});
+	size_t aUniqueCount = 0;
+	for (size_t i = 0; i < anEdges.size(); ++i)
+	{
+		if (i + 1 == anEdges.size() || anEdges[i + 1].myBeginId != anEdges[i].myBeginId || anEdges[i + 1].myEndId != anEdges[i].myEndId)
+		{
+			anEdges[aUniqueCount++] = anEdges[i];
+		}
 	}
+	anEdges.resize(aUniqueCount);
 
-	//  myAdjacencyMap   ,        int.
-	//   ,       .
-	//      0.
-	std::map<NodeType, std::pair<NodeList, int>> aMap;
-	for (const auto& aKeyValue : myAdjacencyMap)
+	//      
+	for (size_t aFirst = 0; aFirst < anEdges.size();)
 	{
-		const NodeType& aKey   = aKeyValue.first;
-		const NodeList& aValue = aKeyValue.second;
-
-		aMap[aKey] = std::make_pair(aValue, 0);
+		size_t aLast = aFirst + 1;
+		while (aLast < anEdges.size() && anEdges[aLast].myBeginId == anEdges[aFirst].myBeginId)
+		{
+			++aLast;
+		}
+		anAddedCount += mergeEdges(anEdges, aFirst, aLast, anIsWeightReplaced);
+		aFirst = aLast;
+	}
+	myEdgeCount += anAddedCount;
+	if (anAddedCount == 0)
+	{
+		return 0;
 	}
 
-	std::queue<NodeType> aNodeQueue; //    
-	aNodeQueue.push(theBeginNode); //     
-
-	bool anIsFirstIteration = true;
-
-	//    
-	while (!aNodeQueue.empty())
+	for (const PendingEdge& anEdge : anEdges)
 	{
-		const NodeType& aCurrentNode = aNodeQueue.front();
-		if (!anIsFirstIteration && aCurrentNode == theEndNode)
+		if (!anEdge.myIsAdded)
+			continue;
+		if (myIsWeakComponentTrackingEnabled && !myWeakComponentsOutdated.IsSet() && myWeakComponents.Unite(anEdge.myBeginId, anEdge.myEndId))
 		{
-			//          
-			// (        ,    ,
-			//          ,        )
-			return true;
+			--myWeakComponentCount;
 		}
-		aMap[aCurrentNode].second += 1;
-		const NodeList& aNodeList = aMap[aCurrentNode].first; //     
-		for (const auto& aNode : aNodeList)
+		//          ,    
+		if (myIsReachabilityIndexEnabled && !myReachabilityIndexOutdated.IsSet() && !myReachabilityIndex.Reaches(anEdge.myBeginId, anEdge.myEndId))
+		{
+			myReachabilityIndexOutdated.Set(true);
+		}
+	}
+
+	if (myIsReverseIndexEnabled)
+	{
+		//     ,        ,   .
+		//       .
+		size_t aNewCount = 0;
+		for (const PendingEdge& anEdge : anEdges)
 		{
-			int aNodeVisitedCounter = aMap[aNode].second;
-			if (aNodeVisitedCounter < 2)
+			if (anEdge.myIsAdded)
 			{
-				aNodeQueue.push(aNode);
+				anEdges[aNewCount++] = PendingEdge{ anEdge.myEndId, anEdge.myBeginId, anEdge.myWeight, true };
 			}
 		}
-
-		aNodeQueue.pop();
-		if (anIsFirstIteration)
+		anEdges.resize(aNewCount);
+		std::sort(anEdges.begin(), anEdges.end(), [](const PendingEdge& theFirst, const PendingEdge& theSecond)
 		{
-			anIsFirstIteration = false;
+			return theFirst.myBeginId != theSecond.myBeginId ? theFirst.myBeginId < theSecond.myBeginId
+			                                                 : theFirst.myEndId < theSecond.myEndId;
+		});
+		for (size_t aFirst = 0; aFirst < anEdges.size();)
+		{
+			size_t aLast = aFirst + 1;
+			while (aLast < anEdges.size() && anEdges[aLast].myBeginId == anEdges[aFirst].myBeginId)
+			{
+				++aLast;
+			}
+			IdList& anIdList = myReverseAdjacency[anEdges[aFirst].myBeginId];
+			size_t aRead = anIdList.size();
+			anIdList.resize(anIdList.size() + (aLast - aFirst));
+			size_t aWrite = anIdList.size();
+			for (size_t i = aLast; i-- > aFirst;)
+			{
+				while (aRead > 0 && anIdList[aRead - 1] > anEdges[i].myEndId)
+				{
+					anIdList[--aWrite] = anIdList[--aRead];
+				}
+				anIdList[--aWrite] = anEdges[i].myEndId;
+			}
+			aFirst = aLast;
 		}
 	}
-	return false;
+	return anAddedCount;
 }
 
 //=========================================================
-// Function : deleteDuplicatesInAdjacencyLists
-// Purpose  :      
+// Function : AddEdge
+// Purpose  :    
 //=========================================================
-template<class NodeType>
-void Graph<NodeType>::deleteDuplicatesInAdjacencyLists()
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::AddEdge(const Edge & theEdge)
 {
-	for (auto anIter = myAdjacencyMap.begin(); anIter != myAdjacencyMap.end(); ++anIter)
-	{
-		auto& aNodeList = anIter->second;
+	return addEdge(theEdge, WeightType(), false);
+}
 
-		//     
-		//  https://en.cppreference.com/w/cpp/container/list/unique  
-		aNodeList.sort(); //  
-		aNodeList.unique();
-	}
+//=========================================================
+// Function : AddEdge
+// Purpose  :       
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::AddEdge(const Edge & theEdge, const WeightType& theWeight)
+{
+	static_assert(IsWeighted, "Graph is not weighted");
+	checkWeight(theWeight);
+	return addEdge(theEdge, theWeight, true);
+}
+
+//=========================================================
+// Function : GetEdgeWeight
+// Purpose  :    
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+const WeightType& Graph<NodeType, NodeIndex, WeightType>::GetEdgeWeight(const Edge& theEdge) const
+{
+	static_assert(IsWeighted, "Graph is not weighted");
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (findNodeId(theEdge.first, aBeginId) && findNodeId(theEdge.second, anEndId))
+	{
+		const IdList& anIdList = myAdjacency[aBeginId];
+		auto aFoundIter = std::lower_bound(anIdList.begin(), anIdList.end(), anEndId);
+		if (aFoundIter != anIdList.end() && *aFoundIter == anEndId)
+		{
+			return myWeights[aBeginId][aFoundIter - anIdList.begin()];
+		}
+	}
+	throw std::invalid_argument("Graph does not contain given edge");
+}
+
+//=========================================================
+// Function : addEdge
+// Purpose  :  
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::addEdge(const Edge& theEdge, const WeightType& theWeight, bool theIsWeightReplaced)
+{
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+
+	if (!findNodeId(theEdge.first, aBeginId) || !findNodeId(theEdge.second, anEndId))
+	{
+		//       
+		throw IncorrectGraphException("Incorrect Node in Edge");
+	}
+	else
+	{
+		if (myIsTopologicalOrderTrackingEnabled && !updateTopologicalOrder(aBeginId, anEndId))
+		{
+			throw IncorrectGraphException("Edge creates a cycle");
+		}
+
+		//    ,    ,    aBeginId
+		bool anEdgeWasAdded = insertEdge(aBeginId, anEndId, theWeight, theIsWeightReplaced);
+		if (anEdgeWasAdded)
+		{
+			++myEdgeCount;
+		}
+
+		if (anEdgeWasAdded && myIsReverseIndexEnabled)
+		{
+			insertSorted(myReverseAdjacency[anEndId], aBeginId);
+		}
+		if (anEdgeWasAdded && myIsWeakComponentTrackingEnabled && !myWeakComponentsOutdated.IsSet() && myWeakComponents.Unite(aBeginId, anEndId))
+		{
+			--myWeakComponentCount;
+		}
+		//          ,    
+		if (anEdgeWasAdded && myIsReachabilityIndexEnabled && !myReachabilityIndexOutdated.IsSet() && !myReachabilityIndex.Reaches(aBeginId, anEndId))
+		{
+			myReachabilityIndexOutdated.Set(true);
+		}
+
+		return anEdgeWasAdded;
+	}
+}
+
+//=========================================================
+// Function : Clear
+// Purpose  :    
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::Clear()
+{
+	myNodeIndex.Clear();
+	myNodes.clear();
+	myAdjacency.clear();
+	myWeights.clear();
+	myFreeIds.clear();
+	myIsIdUsed.clear();
+	myEdgeCount = 0;
+	myReverseAdjacency.clear();
+	myWeakComponents.Reset(0);
+	myWeakComponentCount = 0;
+	myWeakComponentsOutdated.Set(false);
+	myReachabilityIndex = ReachabilityIndex(); //        
+	myReachabilityIndexOutdated.Set(false);
+	myTopologicalPositions.clear();
+	myTopologicalOrderIds.clear();
+}
+
+//=========================================================
+// Function : RemoveNode
+// Purpose  :    
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::RemoveNode(const NodeType& theNode)
+{
+	NodeId anId = 0;
+	if (!findNodeId(theNode, anId))
+	{
+		//     
+		return false;
+	}
+	else
+	{
+		myNodeIndex.Erase(theNode, myNodes); //     
+		myNodes[anId] = NodeType();
+
+		//         
+		if (myIsReverseIndexEnabled)
+		{
+			//   ,       ,
+			//  ,       (    )
+			for (NodeId aPredecessorId : myReverseAdjacency[anId])
+			{
+				if (aPredecessorId != anId)
+				{
+					eraseEdge(aPredecessorId, anId);
+					--myEdgeCount;
+				}
+			}
+			for (NodeId aSuccessorId : myAdjacency[anId])
+			{
+				if (aSuccessorId != anId)
+				{
+					eraseSorted(myReverseAdjacency[aSuccessorId], anId);
+				}
+			}
+			myReverseAdjacency[anId].clear();
+			myReverseAdjacency[anId].shrink_to_fit();
+		}
+		else
+		{
+			for (NodeId aBeginId = 0; aBeginId < myAdjacency.size(); ++aBeginId)
+			{
+				if (aBeginId != anId && eraseEdge(aBeginId, anId))
+				{
+					--myEdgeCount;
+				}
+			}
+		}
+		myEdgeCount -= myAdjacency[anId].size(); //   ( )
+		myAdjacency[anId].clear();
+		myAdjacency[anId].shrink_to_fit();
+		if constexpr (IsWeighted)
+		{
+			myWeights[anId].clear();
+			myWeights[anId].shrink_to_fit();
+		}
+		myFreeIds.push_back(anId);
+		myIsIdUsed[anId] = 0;
+		myWeakComponentsOutdated.Set(myIsWeakComponentTrackingEnabled);
+		myReachabilityIndexOutdated.Set(myIsReachabilityIndexEnabled);
+
+		return true;
+	}
+}
+
+//=========================================================
+// Function : RemoveNodes
+// Purpose  :     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+template<class NodeRange>
+size_t Graph<NodeType, NodeIndex, WeightType>::RemoveNodes(const NodeRange& theNodes)
+{
+	std::pmr::vector<char> anIsRemoved(myNodes.size(), 0, GetMemoryResource());
+	std::pmr::vector<NodeId> aRemovedIds(GetMemoryResource());
+	for (const auto& aNode : theNodes)
+	{
+		NodeId anId = 0;
+		if (findNodeId(aNode, anId) && !anIsRemoved[anId])
+		{
+			anIsRemoved[anId] = 1;
+			aRemovedIds.push_back(anId);
+		}
+	}
+	if (aRemovedIds.empty())
+	{
+		return 0;
+	}
+
+	//          
+	if (myIsReverseIndexEnabled)
+	{
+		// ,   :    ,    ,
+		//     ,   .     .
+		std::pmr::vector<char> anIsTouched(myNodes.size(), 0, GetMemoryResource());
+		std::pmr::vector<char> anIsReverseTouched(myNodes.size(), 0, GetMemoryResource());
+		for (NodeId anId : aRemovedIds)
+		{
+			for (NodeId aPredecessorId : myReverseAdjacency[anId])
+			{
+				if (!anIsRemoved[aPredecessorId] && !anIsTouched[aPredecessorId])
+				{
+					anIsTouched[aPredecessorId] = 1;
+					myEdgeCount -= eraseMarkedEdges(aPredecessorId, anIsRemoved);
+				}
+			}
+			for (NodeId aSuccessorId : myAdjacency[anId])
+			{
+				if (!anIsRemoved[aSuccessorId] && !anIsReverseTouched[aSuccessorId])
+				{
+					anIsReverseTouched[aSuccessorId] = 1;
+					IdList& aPredecessors = myReverseAdjacency[aSuccessorId];
+					aPredecessors.erase(std::remove_if(aPredecessors.begin(), aPredecessors.end(),
+						[&anIsRemoved](NodeId aPredecessorId) { return anIsRemoved[aPredecessorId] != 0; }), aPredecessors.end());
+				}
+			}
+		}
+		for (NodeId anId : aRemovedIds)
+		{
+			myReverseAdjacency[anId].clear();
+			myReverseAdjacency[anId].shrink_to_fit();
+		}
+	}
+	else
+	{
+		for (NodeId aBeginId = 0; aBeginId < myAdjacency.size(); ++aBeginId)
+		{
+			if (!anIsRemoved[aBeginId])
+			{
+				myEdgeCount -= eraseMarkedEdges(aBeginId, anIsRemoved);
+			}
+		}
+	}
+
+	for (NodeId anId : aRemovedIds)
+	{
+		myNodeIndex.Erase(myNodes[anId], myNodes);
+		myNodes[anId] = NodeType();
+		myEdgeCount -= myAdjacency[anId].size(); //   (    )
+		myAdjacency[anId].clear();
+		myAdjacency[anId].shrink_to_fit();
+		if constexpr (IsWeighted)
+		{
+			myWeights[anId].clear();
+			myWeights[anId].shrink_to_fit();
+		}
+		myFreeIds.push_back(anId);
+		myIsIdUsed[anId] = 0;
+	}
+	myWeakComponentsOutdated.Set(myIsWeakComponentTrackingEnabled);
+	myReachabilityIndexOutdated.Set(myIsReachabilityIndexEnabled);
+	return aRemovedIds.size();
+}
+
+//=========================================================
+// Function : RemoveEdge
+// Purpose  :    .
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::RemoveEdge(const Edge& theEdge)
+{
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (!findNodeId(theEdge.first, aBeginId) || !findNodeId(theEdge.second, anEndId))
+	{
+		return false;
+	}
+	else
+	{
+		//  ,   ,   ,   aBeginId
+		if (!eraseEdge(aBeginId, anEndId))
+		{
+			return false;
+		}
+		else
+		{
+			--myEdgeCount;
+			if (myIsReverseIndexEnabled)
+			{
+				eraseSorted(myReverseAdjacency[anEndId], aBeginId);
+			}
+			myWeakComponentsOutdated.Set(myIsWeakComponentTrackingEnabled);
+			myReachabilityIndexOutdated.Set(myIsReachabilityIndexEnabled);
+			return true;
+		}
+	}
+}
+
+//=========================================================
+// Function : ContainsNode
+// Purpose  : ,     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::ContainsNode(const NodeType& theNode) const
+{
+	NodeId anId = 0;
+	return findNodeId(theNode, anId);
+}
+
+//=========================================================
+// Function : ContainsEdge
+// Purpose  : ,     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::ContainsEdge(const Edge & theEdge) const
+{
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (findNodeId(theEdge.first, aBeginId) && findNodeId(theEdge.second, anEndId))
+	{
+		const IdList& anIdList = myAdjacency[aBeginId];
+		return std::binary_search(anIdList.cbegin(), anIdList.cend(), anEndId);
+	}
+	return false;
+}
+
+//=========================================================
+// Function : IsGraphConnected
+// Purpose  : ,    
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::IsGraphConnected() const
+{
+	const size_t aNodeCount = myNodeIndex.GetSize();
+
+	//     
+	if (aNodeCount == 0)
+		return false;
+
+	// ,    ,   
+	// (      )
+	if (aNodeCount == 1)
+		return true;
+
+	TraversalWorkspace& aWorkspace = GetThreadTraversalWorkspace();
+	const NodeId aRootId = getAnyNodeId();
+
+	//   :       
+	auto aForEachSuccessor = [this](NodeId anId, auto&& theFunction)
+	{
+		for (NodeId aSuccessorId : myAdjacency[anId])
+		{
+			theFunction(aSuccessorId);
+		}
+	};
+	if (countReachableNodes(aRootId, aForEachSuccessor, aWorkspace) != aNodeCount)
+		return false;
+
+	//   :       
+	if (myIsReverseIndexEnabled)
+	{
+		auto aForEachPredecessor = [this](NodeId anId, auto&& theFunction)
+		{
+			for (NodeId aPredecessorId : myReverseAdjacency[anId])
+			{
+				theFunction(aPredecessorId);
+			}
+		};
+		return countReachableNodes(aRootId, aForEachPredecessor, aWorkspace) == aNodeCount;
+	}
+
+	std::pmr::vector<size_t> anOffsets(GetMemoryResource());
+	std::pmr::vector<NodeId> aSources(GetMemoryResource());
+	buildTransposedAdjacency(anOffsets, aSources);
+	auto aForEachPredecessor = [&anOffsets, &aSources](NodeId anId, auto&& theFunction)
+	{
+		for (size_t i = anOffsets[anId]; i < anOffsets[anId + 1]; ++i)
+		{
+			theFunction(aSources[i]);
+		}
+	};
+	return countReachableNodes(aRootId, aForEachPredecessor, aWorkspace) == aNodeCount;
+}
+
+//=========================================================
+// Function : IsGraphConnected
+// Purpose  : ,     (  )
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::IsGraphConnected(TraversalPolicy thePolicy) const
+{
+	const size_t aNodeCount = myNodeIndex.GetSize();
+	if (thePolicy != TraversalPolicy::Parallel || aNodeCount <= 1)
+	{
+		return IsGraphConnected();
+	}
+
+	//    IsGraphConnected:          
+	ParallelBfs aBfs;
+	const NodeId aRootId = getAnyNodeId();
+	auto aForEachSuccessor = [this](NodeId anId, auto&& theFunction)
+	{
+		for (NodeId aSuccessorId : myAdjacency[anId])
+		{
+			theFunction(aSuccessorId);
+		}
+	};
+	if (aBfs.Run(aRootId, myNodes.size(), aForEachSuccessor, true) != aNodeCount)
+		return false;
+
+	if (myIsReverseIndexEnabled)
+	{
+		auto aForEachPredecessor = [this](NodeId anId, auto&& theFunction)
+		{
+			for (NodeId aPredecessorId : myReverseAdjacency[anId])
+			{
+				theFunction(aPredecessorId);
+			}
+		};
+		return aBfs.Run(aRootId, myNodes.size(), aForEachPredecessor, true) == aNodeCount;
+	}
+
+	std::pmr::vector<size_t> anOffsets(GetMemoryResource());
+	std::pmr::vector<NodeId> aSources(GetMemoryResource());
+	buildTransposedAdjacency(anOffsets, aSources);
+	auto aForEachPredecessor = [&anOffsets, &aSources](NodeId anId, auto&& theFunction)
+	{
+		for (size_t i = anOffsets[anId]; i < anOffsets[anId + 1]; ++i)
+		{
+			theFunction(aSources[i]);
+		}
+	};
+	return aBfs.Run(aRootId, myNodes.size(), aForEachPredecessor, true) == aNodeCount;
+}
+
+//=========================================================
+// Function : IsGraphWeaklyConnected
+// Purpose  : ,     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::IsGraphWeaklyConnected() const
+{
+	const size_t aNodeCount = myNodeIndex.GetSize();
+
+	//     
+	if (aNodeCount == 0)
+		return false;
+
+	if (myIsWeakComponentTrackingEnabled)
+	{
+		updateWeakComponents();
+		return myWeakComponentCount == 1;
+	}
+
+	//       ,    
+	std::pmr::vector<size_t> anOffsets(GetMemoryResource());
+	std::pmr::vector<NodeId> aSources(GetMemoryResource());
+	if (!myIsReverseIndexEnabled)
+	{
+		buildTransposedAdjacency(anOffsets, aSources);
+	}
+	auto aForEachNeighbor = [this, &anOffsets, &aSources](NodeId anId, auto&& theFunction)
+	{
+		for (NodeId aSuccessorId : myAdjacency[anId])
+		{
+			theFunction(aSuccessorId);
+		}
+		if (myIsReverseIndexEnabled)
+		{
+			for (NodeId aPredecessorId : myReverseAdjacency[anId])
+			{
+				theFunction(aPredecessorId);
+			}
+		}
+		else
+		{
+			for (size_t i = anOffsets[anId]; i < anOffsets[anId + 1]; ++i)
+			{
+				theFunction(aSources[i]);
+			}
+		}
+	};
+	return countReachableNodes(getAnyNodeId(), aForEachNeighbor, GetThreadTraversalWorkspace()) == aNodeCount;
+}
+
+//=========================================================
+// Function : AreWeaklyConnected
+// Purpose  : ,        
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::AreWeaklyConnected(const NodeType& theFirstNode, const NodeType& theSecondNode) const
+{
+	NodeId aFirstId = 0;
+	NodeId aSecondId = 0;
+	if (!findNodeId(theFirstNode, aFirstId) || !findNodeId(theSecondNode, aSecondId))
+	{
+		throw std::invalid_argument("Graph does not contain at least one of given nodes");
+	}
+
+	if (myIsWeakComponentTrackingEnabled)
+	{
+		updateWeakComponents();
+		return myWeakComponents.Find(aFirstId) == myWeakComponents.Find(aSecondId);
+	}
+
+	DisjointSets aSets(GetMemoryResource());
+	buildWeakComponents(aSets);
+	return aSets.Find(aFirstId) == aSets.Find(aSecondId);
+}
+
+//=========================================================
+// Function : ExistsPathBetweenTwoNodes
+// Purpose  : ,      
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::ExistsPathBetweenTwoNodes(const NodeType& theBeginNode, const NodeType& theEndNode) const
+{
+	return ExistsPathBetweenTwoNodes(theBeginNode, theEndNode, GetThreadTraversalWorkspace());
+}
+
+//=========================================================
+// Function : ExistsPathBetweenTwoNodes
+// Purpose  : ,       (   )
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::ExistsPathBetweenTwoNodes(const NodeType& theBeginNode, const NodeType& theEndNode, TraversalWorkspace& theWorkspace) const
+{
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (!findNodeId(theBeginNode, aBeginId) || !findNodeId(theEndNode, anEndId))
+	{
+		throw std::invalid_argument("Graph does not contain at least one of given nodes");
+	}
+
+	if (myIsReachabilityIndexEnabled)
+	{
+		updateReachabilityIndex();
+		return myReachabilityIndex.Reaches(aBeginId, anEndId, theWorkspace);
+	}
+
+	return existsPath(aBeginId, anEndId, theWorkspace);
+}
+
+//=========================================================
+// Function : ExistsPathBetweenTwoNodes
+// Purpose  : ,       (  )
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::ExistsPathBetweenTwoNodes(const NodeType& theBeginNode, const NodeType& theEndNode, TraversalPolicy thePolicy) const
+{
+	if (thePolicy == TraversalPolicy::TopDown || myIsReachabilityIndexEnabled)
+	{
+		return ExistsPathBetweenTwoNodes(theBeginNode, theEndNode);
+	}
+
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (!findNodeId(theBeginNode, aBeginId) || !findNodeId(theEndNode, anEndId))
+	{
+		throw std::invalid_argument("Graph does not contain at least one of given nodes");
+	}
+	if (thePolicy == TraversalPolicy::Parallel)
+	{
+		ParallelBfs aBfs;
+		aBfs.Run(aBeginId, myNodes.size(), [this](NodeId anId, auto&& theFunction)
+		{
+			for (NodeId aNeighborId : myAdjacency[anId])
+			{
+				theFunction(aNeighborId);
+			}
+		}, false, anEndId);
+		return aBfs.IsVisited(anEndId);
+	}
+	return existsPathDirectionOptimizing(aBeginId, anEndId, GetThreadTraversalWorkspace());
+}
+
+//=========================================================
+// Function : ShortestPath
+// Purpose  :     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+typename Graph<NodeType, NodeIndex, WeightType>::NodeList Graph<NodeType, NodeIndex, WeightType>::ShortestPath(const NodeType& theBeginNode, const NodeType& theEndNode) const
+{
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (!findNodeId(theBeginNode, aBeginId) || !findNodeId(theEndNode, anEndId))
+	{
+		throw std::invalid_argument("Graph does not contain at least one of given nodes");
+	}
+
+	//    existsPath,       ,      
+	TraversalWorkspace& aWorkspace = GetThreadTraversalWorkspace();
+	aWorkspace.Reset(myNodes.size());
+	aWorkspace.Push(aBeginId);
+
+	NodeId aCurrentId = 0;
+	while (aWorkspace.Pop(aCurrentId))
+	{
+		for (NodeId aNeighborId : myAdjacency[aCurrentId])
+		{
+			if (!aWorkspace.Visit(aNeighborId))
+				continue;
+
+			aWorkspace.SetParent(aNeighborId, aCurrentId);
+			if (aNeighborId == anEndId)
+			{
+				//         
+				NodeList aPath;
+				NodeId anId = anEndId;
+				do
+				{
+					aPath.push_front(myNodes[anId]);
+					anId = aWorkspace.GetParent(anId);
+				} while (anId != aBeginId);
+				aPath.push_front(myNodes[aBeginId]);
+				return aPath;
+			}
+			aWorkspace.Push(aNeighborId);
+		}
+	}
+	return NodeList();
+}
+
+//=========================================================
+// Function : ShortestPathBidirectional
+// Purpose  :      ( )
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+typename Graph<NodeType, NodeIndex, WeightType>::NodeList Graph<NodeType, NodeIndex, WeightType>::ShortestPathBidirectional(const NodeType& theBeginNode, const NodeType& theEndNode) const
+{
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (!findNodeId(theBeginNode, aBeginId) || !findNodeId(theEndNode, anEndId))
+	{
+		throw std::invalid_argument("Graph does not contain at least one of given nodes");
+	}
+
+	//      :       
+	if (aBeginId == anEndId)
+	{
+		return ShortestPath(theBeginNode, theEndNode);
+	}
+
+	std::pmr::vector<size_t> aTransposedOffsets(GetMemoryResource());
+	std::pmr::vector<NodeId> aTransposedSources(GetMemoryResource());
+	if (!myIsReverseIndexEnabled)
+	{
+		buildTransposedAdjacency(aTransposedOffsets, aTransposedSources);
+	}
+
+	//        ,  - .
+	TraversalWorkspace& aForward = GetThreadTraversalWorkspace(0);
+	TraversalWorkspace& aBackward = GetThreadTraversalWorkspace(1);
+	aForward.Reset(myNodes.size());
+	aBackward.Reset(myNodes.size());
+	aForward.Visit(aBeginId);
+	aBackward.Visit(anEndId);
+	std::pmr::vector<NodeId> aForwardFrontier(1, aBeginId, GetMemoryResource());
+	std::pmr::vector<NodeId> aBackwardFrontier(1, anEndId, GetMemoryResource());
+	std::pmr::vector<NodeId> aNext(GetMemoryResource());
+
+	//   ,   ,  ,    .
+	//    ,    ,        .
+	bool anIsMet = false;
+	NodeId aMeetingBeginId = 0; //  :     ,
+	NodeId aMeetingEndId = 0;   //   - 
+	while (!anIsMet && !aForwardFrontier.empty() && !aBackwardFrontier.empty())
+	{
+		aNext.clear();
+		if (aForwardFrontier.size() <= aBackwardFrontier.size())
+		{
+			for (size_t i = 0; i < aForwardFrontier.size() && !anIsMet; ++i)
+			{
+				const NodeId aCurrentId = aForwardFrontier[i];
+				for (NodeId aSuccessorId : myAdjacency[aCurrentId])
+				{
+					if (aBackward.IsVisited(aSuccessorId))
+					{
+						anIsMet = true;
+						aMeetingBeginId = aCurrentId;
+						aMeetingEndId = aSuccessorId;
+						break;
+					}
+					if (aForward.Visit(aSuccessorId))
+					{
+						aForward.SetParent(aSuccessorId, aCurrentId);
+						aNext.push_back(aSuccessorId);
+					}
+				}
+			}
+			aForwardFrontier.swap(aNext);
+		}
+		else
+		{
+			for (size_t i = 0; i < aBackwardFrontier.size() && !anIsMet; ++i)
+			{
+				const NodeId aCurrentId = aBackwardFrontier[i];
+				const NodeId* aPredecessor = nullptr;
+				const NodeId* aPredecessorsEnd = nullptr;
+				if (myIsReverseIndexEnabled)
+				{
+					aPredecessor = myReverseAdjacency[aCurrentId].data();
+					aPredecessorsEnd = aPredecessor + myReverseAdjacency[aCurrentId].size();
+				}
+				else
+				{
+					aPredecessor = aTransposedSources.data() + aTransposedOffsets[aCurrentId];
+					aPredecessorsEnd = aTransposedSources.data() + aTransposedOffsets[aCurrentId + 1];
+				}
+				for (; aPredecessor != aPredecessorsEnd; ++aPredecessor)
+				{
+					if (aForward.IsVisited(*aPredecessor))
+					{
+						anIsMet = true;
+						aMeetingBeginId = *aPredecessor;
+						aMeetingEndId = aCurrentId;
+						break;
+					}
+					if (aBackward.Visit(*aPredecessor))
+					{
+						aBackward.SetParent(*aPredecessor, aCurrentId);
+						aNext.push_back(*aPredecessor);
+					}
+				}
+			}
+			aBackwardFrontier.swap(aNext);
+		}
+	}
+
+	NodeList aPath;
+	if (!anIsMet)
+	{
+		return aPath;
+	}
+	for (NodeId anId = aMeetingBeginId; ; anId = aForward.GetParent(anId))
+	{
+		aPath.push_front(myNodes[anId]);
+		if (anId == aBeginId)
+			break;
+	}
+	for (NodeId anId = aMeetingEndId; ; anId = aBackward.GetParent(anId))
+	{
+		aPath.push_back(myNodes[anId]);
+		if (anId == anEndId)
+			break;
+	}
+	return aPath;
+}
+
+//=========================================================
+// Function : Distances
+// Purpose  :       
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+std::vector<typename Graph<NodeType, NodeIndex, WeightType>::Distance> Graph<NodeType, NodeIndex, WeightType>::Distances(const NodeType& theSource) const
+{
+	const NodeId aSourceId = GetNodeId(theSource);
+
+	//       ,       :
+	//        .
+	std::vector<Distance> aDistances(myNodes.size(), InfiniteDistance);
+	TraversalWorkspace& aWorkspace = GetThreadTraversalWorkspace();
+	aWorkspace.Reset(myNodes.size());
+	aDistances[aSourceId] = 0;
+	aWorkspace.Push(aSourceId);
+
+	NodeId aCurrentId = 0;
+	while (aWorkspace.Pop(aCurrentId))
+	{
+		const Distance aNextDistance = aDistances[aCurrentId] + 1;
+		for (NodeId aNeighborId : myAdjacency[aCurrentId])
+		{
+			if (aDistances[aNeighborId] == InfiniteDistance)
+			{
+				aDistances[aNeighborId] = aNextDistance;
+				aWorkspace.Push(aNeighborId);
+			}
+		}
+	}
+	return aDistances;
+}
+
+//=========================================================
+// Function : WeightedDistances
+// Purpose  :        
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+std::vector<WeightType> Graph<NodeType, NodeIndex, WeightType>::WeightedDistances(const NodeType& theSource, TraversalPolicy thePolicy) const
+{
+	static_assert(IsWeighted && std::is_arithmetic<WeightType>::value, "Graph is not weighted by arithmetic type");
+	const NodeId aSourceId = GetNodeId(theSource);
+
+	std::vector<WeightType> aDistances(myNodes.size(), GetInfiniteWeight());
+	if (thePolicy == TraversalPolicy::Parallel)
+	{
+		//   -  ,     :    
+		//        .
+		WeightType aMaxWeight = WeightType();
+		for (const WeightList& aWeightList : myWeights)
+		{
+			for (const WeightType& aWeight : aWeightList)
+			{
+				aMaxWeight = std::max(aMaxWeight, aWeight);
+			}
+		}
+		const size_t anAverageDegree = std::max<size_t>(1, myEdgeCount / std::max<size_t>(1, GetNodeCount()));
+		WeightType aDelta = static_cast<WeightType>(aMaxWeight / static_cast<WeightType>(anAverageDegree));
+		if (!(aDelta > WeightType()))
+		{
+			aDelta = WeightType(1);
+		}
+
+		DeltaStepping<WeightType> aDeltaStepping;
+		aDeltaStepping.Run(aSourceId, myNodes.size(), [this](NodeId anId, auto aFunction)
+		{
+			const IdList& anIdList = myAdjacency[anId];
+			const WeightList& aWeightList = myWeights[anId];
+			for (size_t i = 0; i < anIdList.size(); ++i)
+			{
+				aFunction(anIdList[i], aWeightList[i]);
+			}
+		}, aDelta, aMaxWeight);
+		for (NodeId anId = 0; anId < aDistances.size(); ++anId)
+		{
+			aDistances[anId] = aDeltaStepping.GetDistance(anId);
+		}
+		return aDistances;
+	}
+
+	//  : ,   ,   
+	// ( ,       ).
+	PairingHeap<WeightType>& aHeap = GetThreadPairingHeap<WeightType>();
+	aHeap.Reset(myNodes.size());
+	aDistances[aSourceId] = WeightType();
+	aHeap.Push(aSourceId, WeightType());
+	while (!aHeap.IsEmpty())
+	{
+		const NodeId aCurrentId = aHeap.Pop();
+		const IdList& anIdList = myAdjacency[aCurrentId];
+		const WeightList& aWeightList = myWeights[aCurrentId];
+		for (size_t i = 0; i < anIdList.size(); ++i)
+		{
+			const NodeId aNeighborId = anIdList[i];
+			const WeightType aDistance = aDistances[aCurrentId] + aWeightList[i];
+			if (aDistance < aDistances[aNeighborId])
+			{
+				const bool anIsInHeap = aHeap.Contains(aNeighborId);
+				aDistances[aNeighborId] = aDistance;
+				if (anIsInHeap)
+				{
+					aHeap.DecreaseKey(aNeighborId, aDistance);
+				}
+				else
+				{
+					aHeap.Push(aNeighborId, aDistance);
+				}
+			}
+		}
+	}
+	return aDistances;
+}
+
+//=========================================================
+// Function : WeightedShortestPath
+// Purpose  :        
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+typename Graph<NodeType, NodeIndex, WeightType>::NodeList Graph<NodeType, NodeIndex, WeightType>::WeightedShortestPath(const NodeType& theBeginNode, const NodeType& theEndNode) const
+{
+	static_assert(IsWeighted && std::is_arithmetic<WeightType>::value, "Graph is not weighted by arithmetic type");
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (!findNodeId(theBeginNode, aBeginId) || !findNodeId(theEndNode, anEndId))
+	{
+		throw std::invalid_argument("Graph does not contain at least one of given nodes");
+	}
+
+	//     ,      (   ).
+	//    ShortestPath,       ,      ,
+	//         .
+	TraversalWorkspace& aWorkspace = GetThreadTraversalWorkspace();
+	PairingHeap<WeightType>& aHeap = GetThreadPairingHeap<WeightType>();
+	aWorkspace.Reset(myNodes.size());
+	aHeap.Reset(myNodes.size());
+	auto aRelaxEdges = [&](NodeId theId, const WeightType& theDistance)
+	{
+		const IdList& anIdList = myAdjacency[theId];
+		const WeightList& aWeightList = myWeights[theId];
+		for (size_t i = 0; i < anIdList.size(); ++i)
+		{
+			const NodeId aNeighborId = anIdList[i];
+			const WeightType aDistance = theDistance + aWeightList[i];
+			if (aWorkspace.IsVisited(aNeighborId))
+				continue;
+			if (!aHeap.Contains(aNeighborId))
+			{
+				aHeap.Push(aNeighborId, aDistance);
+			}
+			else if (aDistance < aHeap.GetKey(aNeighborId))
+			{
+				aHeap.DecreaseKey(aNeighborId, aDistance);
+			}
+			else
+			{
+				continue;
+			}
+			aWorkspace.SetParent(aNeighborId, theId);
+		}
+	};
+
+	aRelaxEdges(aBeginId, WeightType());
+	while (!aHeap.IsEmpty())
+	{
+		const NodeId aCurrentId = aHeap.Pop();
+		aWorkspace.Visit(aCurrentId);
+		if (aCurrentId == anEndId)
+		{
+			//         
+			NodeList aPath;
+			NodeId anId = anEndId;
+			do
+			{
+				aPath.push_front(myNodes[anId]);
+				anId = aWorkspace.GetParent(anId);
+			} while (anId != aBeginId);
+			aPath.push_front(myNodes[aBeginId]);
+			return aPath;
+		}
+		aRelaxEdges(aCurrentId, aHeap.GetKey(aCurrentId));
+	}
+	return NodeList();
+}
+
+//=========================================================
+// Function : ExistsPaths
+// Purpose  :    
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+std::vector<bool> Graph<NodeType, NodeIndex, WeightType>::ExistsPaths(const std::vector<std::pair<NodeType, NodeType>>& theQueries) const
+{
+	//    :     
+	struct Query
+	{
+		NodeId myBeginId;
+		NodeId myEndId;
+		size_t myPosition;
+	};
+
+	std::pmr::vector<Query> aQueries(GetMemoryResource());
+	aQueries.reserve(theQueries.size());
+	for (size_t i = 0; i < theQueries.size(); ++i)
+	{
+		NodeId aBeginId = 0;
+		NodeId anEndId = 0;
+		if (!findNodeId(theQueries[i].first, aBeginId) || !findNodeId(theQueries[i].second, anEndId))
+		{
+			throw std::invalid_argument("Graph does not contain at least one of given nodes");
+		}
+		aQueries.push_back(Query{ aBeginId, anEndId, i });
+	}
+
+	//   :      ,       .
+	std::pmr::vector<char> anAnswers(aQueries.size(), 0, GetMemoryResource());
+
+	if (myIsReachabilityIndexEnabled)
+	{
+		updateReachabilityIndex();
+		for (const Query& aQuery : aQueries)
+		{
+			anAnswers[aQuery.myPosition] = myReachabilityIndex.Reaches(aQuery.myBeginId, aQuery.myEndId);
+		}
+	}
+	else
+	{
+		//     
+		std::sort(aQueries.begin(), aQueries.end(), [](const Query& theLeft, const Query& theRight)
+		{
+			return theLeft.myBeginId < theRight.myBeginId;
+		});
+		std::pmr::vector<size_t> aGroupBegins(GetMemoryResource()); //    aQueries (   )
+		for (size_t i = 0; i < aQueries.size(); ++i)
+		{
+			if (i == 0 || aQueries[i].myBeginId != aQueries[i - 1].myBeginId)
+			{
+				aGroupBegins.push_back(i);
+			}
+		}
+		aGroupBegins.push_back(aQueries.size());
+		const size_t aGroupCount = aGroupBegins.size() - 1;
+		const size_t aBatchCount = (aGroupCount + MultiSourceBfs::LaneCount - 1) / MultiSourceBfs::LaneCount;
+
+		//         ,       .
+		//          .
+		std::atomic<size_t> aNextBatch(0);
+		auto aProcessBatches = [&]()
+		{
+			if (aGroupCount == 1)
+			{
+				//    -  ,      ,
+				//     
+				TraversalWorkspace& aWorkspace = GetThreadTraversalWorkspace();
+				if (aQueries.size() == 1)
+				{
+					anAnswers[0] = existsPath(aQueries[0].myBeginId, aQueries[0].myEndId, aWorkspace);
+					return;
+				}
+				visitReachableNodes(aQueries[0].myBeginId, aWorkspace);
+				for (const Query& aQuery : aQueries)
+				{
+					anAnswers[aQuery.myPosition] = aWorkspace.IsVisited(aQuery.myEndId);
+				}
+				return;
+			}
+
+			MultiSourceBfs& aBfs = GetThreadMultiSourceBfs();
+			NodeId aSourceIds[MultiSourceBfs::LaneCount];
+			for (size_t aBatch = aNextBatch++; aBatch < aBatchCount; aBatch = aNextBatch++)
+			{
+				//  i  -  aFirstGroup + i
+				const size_t aFirstGroup = aBatch * MultiSourceBfs::LaneCount;
+				const size_t aLaneCount = std::min(MultiSourceBfs::LaneCount, aGroupCount - aFirstGroup);
+				for (size_t aLane = 0; aLane < aLaneCount; ++aLane)
+				{
+					aSourceIds[aLane] = aQueries[aGroupBegins[aFirstGroup + aLane]].myBeginId;
+				}
+				aBfs.Run(myAdjacency, aSourceIds, aLaneCount);
+				for (size_t aLane = 0; aLane < aLaneCount; ++aLane)
+				{
+					for (size_t i = aGroupBegins[aFirstGroup + aLane]; i < aGroupBegins[aFirstGroup + aLane + 1]; ++i)
+					{
+						anAnswers[aQueries[i].myPosition] = (aBfs.GetSeenLanes(aQueries[i].myEndId) >> aLane) & 1;
+					}
+				}
+			}
+		};
+
+		auto aWork = [&aProcessBatches](size_t) { aProcessBatches(); };
+		//     , ,   ,     
+		GetThreadPool().RunIndependent(std::min(ThreadPool::GetDefaultThreadCount(), aBatchCount), aWork);
+	}
+
+	return std::vector<bool>(anAnswers.begin(), anAnswers.end());
+}
+
+//=========================================================
+// Function : VisitFromSources
+// Purpose  :       
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+template<class OnVisit>
+void Graph<NodeType, NodeIndex, WeightType>::VisitFromSources(const std::vector<NodeId>& theSourceIds, OnVisit theOnVisit) const
+{
+	if (theSourceIds.size() > MultiSourceBfs::LaneCount)
+	{
+		throw std::invalid_argument("Too many source nodes");
+	}
+	for (NodeId aSourceId : theSourceIds)
+	{
+		if (!IsNodeIdUsed(aSourceId))
+		{
+			throw std::invalid_argument("Graph does not contain at least one of given nodes");
+		}
+	}
+	GetThreadMultiSourceBfs().Run(myAdjacency, theSourceIds.data(), theSourceIds.size(), theOnVisit);
+}
+
+//=========================================================
+// Function : TopologicalOrder
+// Purpose  :    
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::TopologicalOrder(NodeList& theOrder, NodeList& theCycle) const
+{
+	theCycle.clear();
+	if (TopologicalOrder(theOrder))
+	{
+		return true;
+	}
+
+	// ,    , -    ,   .      
+	//     (     ), ,     
+	// ,    .
+	const TraversalWorkspace& anOrdered = GetThreadTraversalWorkspace();
+	TraversalWorkspace& aWalk = GetThreadTraversalWorkspace(1);
+	aWalk.Reset(myNodes.size());
+	NodeId aStartId = 0;
+	for (NodeId aBeginId = 0; aBeginId < myAdjacency.size(); ++aBeginId)
+	{
+		if (!myIsIdUsed[aBeginId] || anOrdered.IsVisited(aBeginId))
+			continue;
+		for (NodeId anEndId : myAdjacency[aBeginId])
+		{
+			if (!anOrdered.IsVisited(anEndId))
+			{
+				aWalk.SetParent(anEndId, aBeginId); //       
+				aStartId = anEndId;
+			}
+		}
+	}
+
+	NodeId anId = aStartId;
+	while (aWalk.Visit(anId))
+	{
+		anId = aWalk.GetParent(anId);
+	}
+
+	// anId   ;    ,     
+	const NodeId aCycleId = anId;
+	do
+	{
+		theCycle.push_front(myNodes[anId]);
+		anId = aWalk.GetParent(anId);
+	} while (anId != aCycleId);
+	theCycle.push_front(myNodes[aCycleId]);
+	return false;
+}
+
+//=========================================================
+// Function : TopologicalOrder
+// Purpose  :    
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::TopologicalOrder(NodeList& theOrder) const
+{
+	theOrder.clear();
+	if (myIsTopologicalOrderTrackingEnabled)
+	{
+		for (NodeId anId : myTopologicalOrderIds)
+		{
+			if (myIsIdUsed[anId])
+			{
+				theOrder.push_back(myNodes[anId]);
+			}
+		}
+		return true;
+	}
+
+	std::pmr::vector<NodeId> anOrderIds(GetMemoryResource());
+	const bool anIsAcyclic = sortTopologically(anOrderIds);
+	for (NodeId anId : anOrderIds)
+	{
+		theOrder.push_back(myNodes[anId]);
+	}
+	return anIsAcyclic;
+}
+
+//=========================================================
+// Function : sortTopologically
+// Purpose  :    
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::sortTopologically(std::pmr::vector<NodeId>& theOrderIds) const
+{
+	theOrderIds.clear();
+
+	//  :    ,      ,      .
+	std::pmr::vector<uint32_t> anInDegrees(myNodes.size(), 0, GetMemoryResource());
+	for (NodeId aBeginId = 0; aBeginId < myAdjacency.size(); ++aBeginId)
+	{
+		for (NodeId anEndId : myAdjacency[aBeginId])
+		{
+			++anInDegrees[anEndId];
+		}
+	}
+
+	// ,   ,     (   )
+	TraversalWorkspace& aWorkspace = GetThreadTraversalWorkspace();
+	aWorkspace.Reset(myNodes.size());
+	for (NodeId anId = 0; anId < myNodes.size(); ++anId)
+	{
+		if (myIsIdUsed[anId] && anInDegrees[anId] == 0)
+		{
+			aWorkspace.Visit(anId);
+			aWorkspace.Push(anId);
+		}
+	}
+
+	NodeId aCurrentId = 0;
+	while (aWorkspace.Pop(aCurrentId))
+	{
+		theOrderIds.push_back(aCurrentId);
+		for (NodeId aNeighborId : myAdjacency[aCurrentId])
+		{
+			if (--anInDegrees[aNeighborId] == 0)
+			{
+				aWorkspace.Visit(aNeighborId);
+				aWorkspace.Push(aNeighborId);
+			}
+		}
+	}
+	return theOrderIds.size() == GetNodeCount();
+}
+
+//=========================================================
+// Function : HasCycle
+// Purpose  :     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::HasCycle() const
+{
+	//       :      ,   
+	//  ,       ( ).
+	enum State : char { NotVisited, OnStack, Finished };
+	std::pmr::vector<char> aStates(myNodes.size(), NotVisited, GetMemoryResource());
+	std::pmr::vector<std::pair<NodeId, size_t>> aCallStack(GetMemoryResource()); // (,   )
+
+	for (NodeId aRootId = 0; aRootId < myNodes.size(); ++aRootId)
+	{
+		if (!myIsIdUsed[aRootId] || aStates[aRootId] != NotVisited)
+			continue;
+
+		aStates[aRootId] = OnStack;
+		aCallStack.emplace_back(aRootId, 0);
+		while (!aCallStack.empty())
+		{
+			const NodeId aCurrentId = aCallStack.back().first;
+			size_t& aPosition = aCallStack.back().second;
+			if (aPosition == myAdjacency[aCurrentId].size())
+			{
+				aStates[aCurrentId] = Finished;
+				aCallStack.pop_back();
+				continue;
+			}
+
+			const NodeId aNextId = myAdjacency[aCurrentId][aPosition++];
+			if (aStates[aNextId] == OnStack)
+			{
+				return true;
+			}
+			if (aStates[aNextId] == NotVisited)
+			{
+				aStates[aNextId] = OnStack;
+				aCallStack.emplace_back(aNextId, 0);
+			}
+		}
+	}
+	return false;
+}
+
+//=========================================================
+// Function : GetStrongComponents
+// Purpose  :      
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+StrongComponents Graph<NodeType, NodeIndex, WeightType>::GetStrongComponents() const
+{
+	return StrongComponents(myAdjacency, myIsIdUsed);
+}
+
+//=========================================================
+// Function : GetCondensation
+// Purpose  :   
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+Graph<StrongComponents::ComponentId> Graph<NodeType, NodeIndex, WeightType>::GetCondensation() const
+{
+	const StrongComponents aComponents = GetStrongComponents();
+
+	Graph<StrongComponents::ComponentId> aCondensation(GetMemoryResource());
+	for (StrongComponents::ComponentId aComponentId = 0; aComponentId < aComponents.GetComponentCount(); ++aComponentId)
+	{
+		aCondensation.AddNode(aComponentId);
+	}
+	for (StrongComponents::ComponentId aComponentId = 0; aComponentId < aComponents.GetComponentCount(); ++aComponentId)
+	{
+		aComponents.ForEachSuccessorComponent(aComponentId, [&aCondensation, aComponentId](StrongComponents::ComponentId aSuccessorId)
+		{
+			aCondensation.AddEdge({ aComponentId, aSuccessorId });
+		});
+	}
+	return aCondensation;
+}
+
+//=========================================================
+// Function : GetNodeId
+// Purpose  :  
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+typename Graph<NodeType, NodeIndex, WeightType>::NodeId Graph<NodeType, NodeIndex, WeightType>::GetNodeId(const NodeType& theNode) const
+{
+	NodeId anId = 0;
+	if (!findNodeId(theNode, anId))
+	{
+		throw std::invalid_argument("Graph does not contain given node");
+	}
+	return anId;
+}
+
+//=========================================================
+// Function : GetAdjacencyMap
+// Purpose  :  std::map   
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+typename Graph<NodeType, NodeIndex, WeightType>::GraphMap Graph<NodeType, NodeIndex, WeightType>::GetAdjacencyMap() const
+{
+	GraphMap anAdjacencyMap;
+	myNodeIndex.ForEach(myNodes, [this, &anAdjacencyMap](const NodeType& aNode, NodeId anId)
+	{
+		anAdjacencyMap.emplace(aNode, getSortedNodeList(anId));
+	});
+	return anAdjacencyMap;
+}
+
+//=========================================================
+// Function : operator==
+// Purpose  :  
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::operator==(const Graph& theGraph) const
+{
+	if (myNodeIndex.GetSize() != theGraph.myNodeIndex.GetSize() || myEdgeCount != theGraph.myEdgeCount)
+	{
+		return false;
+	}
+
+	//     .  ,      ,
+	//     ,    .
+	std::pmr::vector<NodeId> anOtherIds(myNodes.size(), 0, GetMemoryResource());
+	for (NodeId anId = 0; anId < myNodes.size(); ++anId)
+	{
+		if (myIsIdUsed[anId] && !theGraph.findNodeId(myNodes[anId], anOtherIds[anId]))
+		{
+			return false;
+		}
+	}
+
+	//       :    ,  
+	//    ,     (   ).
+	std::pmr::vector<std::pair<NodeId, uint32_t>> anEnds(GetMemoryResource());
+	for (NodeId anId = 0; anId < myNodes.size(); ++anId)
+	{
+		if (!myIsIdUsed[anId])
+			continue;
+		const IdList& anIdList = myAdjacency[anId];
+		const IdList& anOtherIdList = theGraph.myAdjacency[anOtherIds[anId]];
+		if (anIdList.size() != anOtherIdList.size())
+		{
+			return false;
+		}
+		anEnds.clear();
+		for (size_t i = 0; i < anIdList.size(); ++i)
+		{
+			anEnds.emplace_back(anOtherIds[anIdList[i]], static_cast<uint32_t>(i));
+		}
+		if (!std::is_sorted(anEnds.begin(), anEnds.end()))
+		{
+			std::sort(anEnds.begin(), anEnds.end());
+		}
+		for (size_t i = 0; i < anEnds.size(); ++i)
+		{
+			if (anEnds[i].first != anOtherIdList[i])
+			{
+				return false;
+			}
+			if constexpr (IsWeighted)
+			{
+				if (!(myWeights[anId][anEnds[i].second] == theGraph.myWeights[anOtherIds[anId]][i]))
+				{
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+//=========================================================
+// Function : SetReverseIndexEnabled
+// Purpose  :     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::SetReverseIndexEnabled(bool theIsEnabled)
+{
+	if (theIsEnabled == myIsReverseIndexEnabled)
+	{
+		return;
+	}
+
+	myIsReverseIndexEnabled = theIsEnabled;
+	if (myIsReverseIndexEnabled)
+	{
+		rebuildReverseIndex();
+	}
+	else
+	{
+		myReverseAdjacency.clear();
+		myReverseAdjacency.shrink_to_fit();
+	}
+}
+
+//=========================================================
+// Function : SetWeakComponentTrackingEnabled
+// Purpose  :       
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::SetWeakComponentTrackingEnabled(bool theIsEnabled)
+{
+	if (theIsEnabled == myIsWeakComponentTrackingEnabled)
+	{
+		return;
+	}
+
+	myIsWeakComponentTrackingEnabled = theIsEnabled;
+	if (myIsWeakComponentTrackingEnabled)
+	{
+		myWeakComponentCount = buildWeakComponents(myWeakComponents);
+	}
+	else
+	{
+		myWeakComponents = DisjointSets(GetMemoryResource());
+		myWeakComponentCount = 0;
+	}
+	myWeakComponentsOutdated.Set(false);
+}
+
+//=========================================================
+// Function : SetReachabilityIndexEnabled
+// Purpose  :     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::SetReachabilityIndexEnabled(bool theIsEnabled)
+{
+	if (theIsEnabled == myIsReachabilityIndexEnabled)
+	{
+		return;
+	}
+
+	//     
+	myIsReachabilityIndexEnabled = theIsEnabled;
+	myReachabilityIndex = ReachabilityIndex();
+	myReachabilityIndexOutdated.Set(theIsEnabled);
+}
+
+//=========================================================
+// Function : SetTopologicalOrderTrackingEnabled
+// Purpose  :      
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::SetTopologicalOrderTrackingEnabled(bool theIsEnabled)
+{
+	if (theIsEnabled == myIsTopologicalOrderTrackingEnabled)
+	{
+		return;
+	}
+
+	if (theIsEnabled && !rebuildTopologicalOrder())
+	{
+		throw IncorrectGraphException("Graph contains a cycle");
+	}
+	if (!theIsEnabled)
+	{
+		myTopologicalPositions = std::pmr::vector<uint32_t>(GetMemoryResource());
+		myTopologicalOrderIds = std::pmr::vector<NodeId>(GetMemoryResource());
+	}
+	myIsTopologicalOrderTrackingEnabled = theIsEnabled;
+}
+
+//=========================================================
+// Function : finishBuild
+// Purpose  :   
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::finishBuild(bool theHasEdges)
+{
+	myEdgeCount = 0;
+	for (const IdList& anIdList : myAdjacency)
+	{
+		myEdgeCount += anIdList.size();
+	}
+
+	if (myIsReverseIndexEnabled)
+	{
+		rebuildReverseIndex();
+	}
+	if (myIsReachabilityIndexEnabled && theHasEdges)
+	{
+		myReachabilityIndexOutdated.Set(true);
+	}
+	if (myIsTopologicalOrderTrackingEnabled && !rebuildTopologicalOrder())
+	{
+		myIsTopologicalOrderTrackingEnabled = false;
+		throw IncorrectGraphException("Graph contains a cycle");
+	}
+}
+
+//=========================================================
+// Function : insertEdge
+// Purpose  :      
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::insertEdge(NodeId theBeginId, NodeId theEndId, const WeightType& theWeight, bool theIsWeightReplaced)
+{
+	IdList& anIdList = myAdjacency[theBeginId];
+	auto aFoundIter = std::lower_bound(anIdList.begin(), anIdList.end(), theEndId);
+	const size_t aPosition = aFoundIter - anIdList.begin();
+	if (aFoundIter != anIdList.end() && *aFoundIter == theEndId)
+	{
+		if constexpr (IsWeighted)
+		{
+			if (theIsWeightReplaced)
+			{
+				myWeights[theBeginId][aPosition] = theWeight;
+			}
+		}
+		return false;
+	}
+	anIdList.insert(aFoundIter, theEndId);
+	if constexpr (IsWeighted)
+	{
+		myWeights[theBeginId].insert(myWeights[theBeginId].begin() + aPosition, theWeight);
+	}
+	return true;
+}
+
+//=========================================================
+// Function : eraseEdge
+// Purpose  :      
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::eraseEdge(NodeId theBeginId, NodeId theEndId)
+{
+	IdList& anIdList = myAdjacency[theBeginId];
+	auto aFoundIter = std::lower_bound(anIdList.begin(), anIdList.end(), theEndId);
+	if (aFoundIter == anIdList.end() || *aFoundIter != theEndId)
+	{
+		return false;
+	}
+	if constexpr (IsWeighted)
+	{
+		myWeights[theBeginId].erase(myWeights[theBeginId].begin() + (aFoundIter - anIdList.begin()));
+	}
+	anIdList.erase(aFoundIter);
+	return true;
+}
+
+//=========================================================
+// Function : mergeEdges
+// Purpose  :      
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+size_t Graph<NodeType, NodeIndex, WeightType>::mergeEdges(std::pmr::vector<PendingEdge>& theEdges, size_t theFirst, size_t theLast, bool theIsWeightReplaced)
+{
+	const NodeId aBeginId = theEdges[theFirst].myBeginId;
+	IdList& anIdList = myAdjacency[aBeginId];
+
+	//  :      
+	size_t aNewCount = 0;
+	size_t aPosition = 0;
+	for (size_t i = theFirst; i < theLast; ++i)
+	{
+		PendingEdge& anEdge = theEdges[i];
+		while (aPosition < anIdList.size() && anIdList[aPosition] < anEdge.myEndId)
+		{
+			++aPosition;
+		}
+		anEdge.myIsAdded = aPosition == anIdList.size() || anIdList[aPosition] != anEdge.myEndId;
+		if (anEdge.myIsAdded)
+		{
+			++aNewCount;
+		}
+		else if constexpr (IsWeighted)
+		{
+			if (theIsWeightReplaced)
+			{
+				myWeights[aBeginId][aPosition] = anEdge.myWeight;
+			}
+		}
+	}
+	if (aNewCount == 0)
+	{
+		return 0;
+	}
+
+	//  :   ,        
+	size_t aRead = anIdList.size();
+	anIdList.resize(anIdList.size() + aNewCount);
+	if constexpr (IsWeighted)
+	{
+		myWeights[aBeginId].resize(anIdList.size());
+	}
+	size_t aWrite = anIdList.size();
+	for (size_t i = theLast; i-- > theFirst;)
+	{
+		const PendingEdge& anEdge = theEdges[i];
+		if (!anEdge.myIsAdded)
+			continue;
+		while (aRead > 0 && anIdList[aRead - 1] > anEdge.myEndId)
+		{
+			--aRead;
+			--aWrite;
+			anIdList[aWrite] = anIdList[aRead];
+			if constexpr (IsWeighted)
+			{
+				myWeights[aBeginId][aWrite] = myWeights[aBeginId][aRead];
+			}
+		}
+		--aWrite;
+		anIdList[aWrite] = anEdge.myEndId;
+		if constexpr (IsWeighted)
+		{
+			myWeights[aBeginId][aWrite] = anEdge.myWeight;
+		}
+	}
+	return aNewCount;
+}
+
+//=========================================================
+// Function : eraseMarkedEdges
+// Purpose  :        
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+size_t Graph<NodeType, NodeIndex, WeightType>::eraseMarkedEdges(NodeId theBeginId, const std::pmr::vector<char>& theIsRemoved)
+{
+	//       (     )
+	IdList& anIdList = myAdjacency[theBeginId];
+	size_t aWrite = 0;
+	for (size_t aRead = 0; aRead < anIdList.size(); ++aRead)
+	{
+		if (theIsRemoved[anIdList[aRead]])
+			continue;
+		anIdList[aWrite] = anIdList[aRead];
+		if constexpr (IsWeighted)
+		{
+			myWeights[theBeginId][aWrite] = myWeights[theBeginId][aRead];
+		}
+		++aWrite;
+	}
+
+	const size_t anErasedCount = anIdList.size() - aWrite;
+	anIdList.resize(aWrite);
+	if constexpr (IsWeighted)
+	{
+		myWeights[theBeginId].resize(aWrite);
+	}
+	return anErasedCount;
+}
+
+//=========================================================
+// Function : getRangeSize
+// Purpose  :   
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+template<class Range>
+size_t Graph<NodeType, NodeIndex, WeightType>::getRangeSize(Range& theRange)
+{
+	typedef decltype(std::begin(theRange)) Iterator;
+	if constexpr (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value)
+	{
+		return static_cast<size_t>(std::distance(std::begin(theRange), std::end(theRange)));
+	}
+	else
+	{
+		return 0; //     
+	}
+}
+
+//=========================================================
+// Function : buildFromRanges
+// Purpose  :       
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+template<class NodeRange, class EdgeRange>
+void Graph<NodeType, NodeIndex, WeightType>::buildFromRanges(NodeRange&& theNodes, EdgeRange&& theEdges, size_t theThreadCount)
+{
+	reserveNodes(getRangeSize(theNodes));
+	for (auto&& aNode : theNodes)
+	{
+		//    
+		if constexpr (!std::is_lvalue_reference<NodeRange>::value && IsOwningRange<std::remove_reference_t<NodeRange>>::value)
+		{
+			AddNode(std::move(aNode)); //    rvalue -   
+		}
+		else
+		{
+			AddNode(std::forward<decltype(aNode)>(aNode)); //   ,  
+		}
+	}
+
+	//   
+	// (     ).
+	finishBuild(loadEdges(std::forward<EdgeRange>(theEdges), theThreadCount));
+}
+
+//=========================================================
+// Function : resolveEdge
+// Purpose  :     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+template<class EdgeElement>
+bool Graph<NodeType, NodeIndex, WeightType>::resolveEdge(const EdgeElement& theEdge, SortedEdge& theSortedEdge) const
+{
+	NodeId aBeginId = 0;
+	NodeId anEndId = 0;
+	if (!findNodeId(edgeOf(theEdge).first, aBeginId) || !findNodeId(edgeOf(theEdge).second, anEndId))
+	{
+		return false;
+	}
+	const uint64_t aKey = (uint64_t(aBeginId) << 32) | anEndId;
+	if constexpr (IsWeighted)
+	{
+		if (weightOf(theEdge) < WeightType())
+		{
+			return false;
+		}
+		theSortedEdge = SortedEdge(aKey, weightOf(theEdge));
+	}
+	else
+	{
+		theSortedEdge = aKey;
+	}
+	return true;
+}
+
+//=========================================================
+// Function : throwEdgeError
+// Purpose  :       
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+template<class EdgeElement>
+void Graph<NodeType, NodeIndex, WeightType>::throwEdgeError(const EdgeElement& theEdge) const
+{
+	if (!ContainsNode(edgeOf(theEdge).first) || !ContainsNode(edgeOf(theEdge).second))
+	{
+		//       
+		throw IncorrectGraphException("Incorrect Node in Edge");
+	}
+	if constexpr (IsWeighted)
+	{
+		checkWeight(weightOf(theEdge));
+	}
+}
+
+//=========================================================
+// Function : loadEdges
+// Purpose  :      
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+template<class EdgeRange>
+bool Graph<NodeType, NodeIndex, WeightType>::loadEdges(EdgeRange&& theEdges, size_t theThreadCount)
+{
+	std::pmr::vector<SortedEdge> anEdges(GetMemoryResource());
+	typedef decltype(std::begin(theEdges)) Iterator;
+	if constexpr (std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value)
+	{
+		//       ,      .
+		//       ;     ,
+		//       .
+		constexpr size_t aChunkSize = 4096; //  ,     
+		const auto aFirstEdge = std::begin(theEdges);
+		const size_t aCount = static_cast<size_t>(std::end(theEdges) - aFirstEdge);
+		anEdges.resize(aCount);
+		std::atomic<size_t> aNextChunk(0);
+		std::atomic<size_t> anErrorIndex(aCount);
+		auto aResolveChunks = [&]()
+		{
+			for (size_t aChunk = aNextChunk++; aChunk * aChunkSize < aCount; aChunk = aNextChunk++)
+			{
+				const size_t anEnd = std::min(aCount, (aChunk + 1) * aChunkSize);
+				for (size_t i = aChunk * aChunkSize; i < anEnd; ++i)
+				{
+					if (!resolveEdge(aFirstEdge[i], anEdges[i]))
+					{
+						size_t anIndex = anErrorIndex.load();
+						while (i < anIndex && !anErrorIndex.compare_exchange_weak(anIndex, i))
+						{
+						}
+						break;
+					}
+				}
+			}
+		};
+
+		const size_t aThreadCount = std::max<size_t>(1, std::min(theThreadCount, aCount / aChunkSize));
+		auto aWork = [&aResolveChunks](size_t) { aResolveChunks(); };
+		GetThreadPool().RunIndependent(aThreadCount, aWork); //      
+		if (anErrorIndex < aCount)
+		{
+			throwEdgeError(aFirstEdge[anErrorIndex]);
+		}
+	}
+	else
+	{
+		anEdges.reserve(getRangeSize(theEdges));
+		for (const auto& anEdge : theEdges)
+		{
+			anEdges.emplace_back();
+			if (!resolveEdge(anEdge, anEdges.back()))
+			{
+				throwEdgeError(anEdge);
+			}
+		}
+	}
+
+	//    ,           .
+	//  :       ,     .
+	uint64_t anIdMask = 0;
+	while (anIdMask + 1 < myNodes.size())
+	{
+		anIdMask = 2 * anIdMask + 1;
+	}
+	ParallelRadixSort(theThreadCount).Sort(anEdges, (anIdMask << 32) | anIdMask, sortKeyOf);
+
+	//         
+	std::pmr::vector<PendingEdge> aMergedEdges(GetMemoryResource());
+	for (size_t aFirst = 0, aLast = 0; aFirst < anEdges.size(); aFirst = aLast)
+	{
+		const NodeId aBeginId = static_cast<NodeId>(sortKeyOf(anEdges[aFirst]) >> 32);
+		size_t aUniqueCount = 0;
+		for (aLast = aFirst; aLast < anEdges.size() && (sortKeyOf(anEdges[aLast]) >> 32) == aBeginId; ++aLast)
+		{
+			if (aLast == aFirst || sortKeyOf(anEdges[aLast]) != sortKeyOf(anEdges[aLast - 1]))
+			{
+				++aUniqueCount;
+			}
+		}
+
+		//       
+		auto aForEachUnique = [&](auto&& theFunction)
+		{
+			for (size_t i = aFirst; i < aLast; ++i)
+			{
+				if (i + 1 == aLast || sortKeyOf(anEdges[i + 1]) != sortKeyOf(anEdges[i]))
+				{
+					theFunction(static_cast<NodeId>(sortKeyOf(anEdges[i])), anEdges[i]);
+				}
+			}
+		};
+		IdList& anIdList = myAdjacency[aBeginId];
+		if (anIdList.empty())
+		{
+			anIdList.reserve(aUniqueCount);
+			if constexpr (IsWeighted)
+			{
+				myWeights[aBeginId].reserve(aUniqueCount);
+			}
+			aForEachUnique([&](NodeId theEndId, const SortedEdge& theEdge)
+			{
+				anIdList.push_back(theEndId);
+				if constexpr (IsWeighted)
+				{
+					myWeights[aBeginId].push_back(theEdge.second);
+				}
+			});
+		}
+		else
+		{
+			//      -     ,    
+			aMergedEdges.clear();
+			aForEachUnique([&](NodeId theEndId, const SortedEdge& theEdge)
+			{
+				if constexpr (IsWeighted)
+				{
+					aMergedEdges.push_back(PendingEdge{ aBeginId, theEndId, theEdge.second, false });
+				}
+				else
+				{
+					aMergedEdges.push_back(PendingEdge{ aBeginId, theEndId, WeightType(), false });
+				}
+			});
+			mergeEdges(aMergedEdges, 0, aMergedEdges.size(), true);
+		}
+
+		if (myIsWeakComponentTrackingEnabled && !myWeakComponentsOutdated.IsSet())
+		{
+			aForEachUnique([&](NodeId theEndId, const SortedEdge&)
+			{
+				if (myWeakComponents.Unite(aBeginId, theEndId))
+				{
+					--myWeakComponentCount;
+				}
+			});
+		}
+	}
+	return !anEdges.empty();
+}
+
+//=========================================================
+// Function : reserveNodes
+// Purpose  :     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::reserveNodes(size_t theCount)
+{
+	//    ,         
+	const size_t aRequired = myNodes.size() + theCount;
+	if (aRequired <= myNodes.capacity())
+	{
+		return;
+	}
+	const size_t aCapacity = std::max(aRequired, 2 * myNodes.capacity());
+	myNodes.reserve(aCapacity);
+	myAdjacency.reserve(aCapacity);
+	myIsIdUsed.reserve(aCapacity);
+	if constexpr (IsWeighted)
+	{
+		myWeights.reserve(aCapacity);
+	}
+}
+
+//=========================================================
+// Function : checkWeight
+// Purpose  :   
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::checkWeight(const WeightType& theWeight)
+{
+	if (theWeight < WeightType())
+	{
+		throw IncorrectGraphException("Negative edge weight");
+	}
+}
+
+//=========================================================
+// Function : insertSorted
+// Purpose  :     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::insertSorted(IdList& theIdList, NodeId theId)
+{
+	auto aFoundIter = std::lower_bound(theIdList.begin(), theIdList.end(), theId);
+	if (aFoundIter != theIdList.end() && *aFoundIter == theId)
+	{
+		return false;
+	}
+	theIdList.insert(aFoundIter, theId);
+	return true;
+}
+
+//=========================================================
+// Function : eraseSorted
+// Purpose  :     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::eraseSorted(IdList& theIdList, NodeId theId)
+{
+	auto aFoundIter = std::lower_bound(theIdList.begin(), theIdList.end(), theId);
+	if (aFoundIter == theIdList.end() || *aFoundIter != theId)
+	{
+		return false;
+	}
+	theIdList.erase(aFoundIter);
+	return true;
+}
+
+//=========================================================
+// Function : rebuildReverseIndex
+// Purpose  :   
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::rebuildReverseIndex()
+{
+	myReverseAdjacency.assign(myAdjacency.size(), IdList());
+
+	//     ,      
+	for (NodeId aBeginId = 0; aBeginId < myAdjacency.size(); ++aBeginId)
+	{
+		for (NodeId anEndId : myAdjacency[aBeginId])
+		{
+			myReverseAdjacency[anEndId].push_back(aBeginId);
+		}
+	}
+}
+
+//=========================================================
+// Function : buildWeakComponents
+// Purpose  :      
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+size_t Graph<NodeType, NodeIndex, WeightType>::buildWeakComponents(DisjointSets& theSets) const
+{
+	//      ;     
+	theSets.Reset(myNodes.size());
+	size_t aComponentCount = myNodeIndex.GetSize();
+	for (NodeId aBeginId = 0; aBeginId < myAdjacency.size(); ++aBeginId)
+	{
+		for (NodeId anEndId : myAdjacency[aBeginId])
+		{
+			if (theSets.Unite(aBeginId, anEndId))
+			{
+				--aComponentCount;
+			}
+		}
+	}
+	return aComponentCount;
+}
+
+//=========================================================
+// Function : updateWeakComponents
+// Purpose  :     
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::updateWeakComponents() const
+{
+	myWeakComponentsOutdated.Update([this]
+	{
+		myWeakComponentCount = buildWeakComponents(myWeakComponents);
+	});
+}
+
+//=========================================================
+// Function : updateReachabilityIndex
+// Purpose  :    
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::updateReachabilityIndex() const
+{
+	myReachabilityIndexOutdated.Update([this]
+	{
+		myReachabilityIndex = ReachabilityIndex(myAdjacency, myIsIdUsed);
+	});
+}
+
+//=========================================================
+// Function : rebuildTopologicalOrder
+// Purpose  :    
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::rebuildTopologicalOrder()
+{
+	if (!sortTopologically(myTopologicalOrderIds))
+	{
+		myTopologicalPositions.clear();
+		myTopologicalOrderIds.clear();
+		return false;
+	}
+
+	//   (  )    
+	for (NodeId anId : myFreeIds)
+	{
+		myTopologicalOrderIds.push_back(anId);
+	}
+	myTopologicalPositions.resize(myNodes.size());
+	for (uint32_t aPosition = 0; aPosition < myTopologicalOrderIds.size(); ++aPosition)
+	{
+		myTopologicalPositions[myTopologicalOrderIds[aPosition]] = aPosition;
+	}
+	return true;
+}
+
+//=========================================================
+// Function : updateTopologicalOrder
+// Purpose  :      
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::updateTopologicalOrder(NodeId theBeginId, NodeId theEndId)
+{
+	const uint32_t aLowerBound = myTopologicalPositions[theEndId];
+	const uint32_t anUpperBound = myTopologicalPositions[theBeginId];
+	if (aLowerBound > anUpperBound)
+	{
+		return true; //       
+	}
+	if (theBeginId == theEndId)
+	{
+		return false; // 
+	}
+
+	// ,         .      ,
+	//    .
+	TraversalWorkspace& aForward = GetThreadTraversalWorkspace();
+	aForward.Reset(myNodes.size());
+	std::pmr::vector<NodeId> aForwardIds(GetMemoryResource());
+	aForward.Visit(theEndId);
+	aForward.Push(theEndId);
+	NodeId aCurrentId = 0;
+	while (aForward.Pop(aCurrentId))
+	{
+		aForwardIds.push_back(aCurrentId);
+		for (NodeId aNeighborId : myAdjacency[aCurrentId])
+		{
+			if (aNeighborId == theBeginId)
+			{
+				return false;
+			}
+			if (myTopologicalPositions[aNeighborId] < anUpperBound && aForward.Visit(aNeighborId))
+			{
+				aForward.Push(aNeighborId);
+			}
+		}
+	}
+
+	// ,           .
+	TraversalWorkspace& aBackward = GetThreadTraversalWorkspace(1);
+	aBackward.Reset(myNodes.size());
+	std::pmr::vector<NodeId> aBackwardIds(GetMemoryResource());
+	aBackward.Visit(theBeginId);
+	if (myIsReverseIndexEnabled)
+	{
+		aBackward.Push(theBeginId);
+		while (aBackward.Pop(aCurrentId))
+		{
+			aBackwardIds.push_back(aCurrentId);
+			for (NodeId aPredecessorId : myReverseAdjacency[aCurrentId])
+			{
+				if (myTopologicalPositions[aPredecessorId] > aLowerBound && aBackward.Visit(aPredecessorId))
+				{
+					aBackward.Push(aPredecessorId);
+				}
+			}
+		}
+	}
+	else
+	{
+		//              ,   
+		//         ,    , 
+		//      .
+		aBackwardIds.push_back(theBeginId);
+		for (uint32_t aPosition = anUpperBound - 1; aPosition > aLowerBound; --aPosition)
+		{
+			const NodeId anId = myTopologicalOrderIds[aPosition];
+			for (NodeId aNeighborId : myAdjacency[anId])
+			{
+				if (aBackward.IsVisited(aNeighborId))
+				{
+					aBackward.Visit(anId);
+					aBackwardIds.push_back(anId);
+					break;
+				}
+			}
+		}
+	}
+
+	//      :  ,     ,  ,
+	//    ,   -    .
+	auto aByPosition = [this](NodeId theFirstId, NodeId theSecondId)
+	{
+		return myTopologicalPositions[theFirstId] < myTopologicalPositions[theSecondId];
+	};
+	std::sort(aBackwardIds.begin(), aBackwardIds.end(), aByPosition);
+	std::sort(aForwardIds.begin(), aForwardIds.end(), aByPosition);
+
+	std::pmr::vector<uint32_t> aPositions(GetMemoryResource());
+	aPositions.reserve(aBackwardIds.size() + aForwardIds.size());
+	for (NodeId anId : aBackwardIds)
+	{
+		aPositions.push_back(myTopologicalPositions[anId]);
+	}
+	for (NodeId anId : aForwardIds)
+	{
+		aPositions.push_back(myTopologicalPositions[anId]);
+	}
+	std::sort(aPositions.begin(), aPositions.end());
+
+	size_t anIndex = 0;
+	for (const std::pmr::vector<NodeId>* anIds : { &aBackwardIds, &aForwardIds })
+	{
+		for (NodeId anId : *anIds)
+		{
+			myTopologicalPositions[anId] = aPositions[anIndex];
+			myTopologicalOrderIds[aPositions[anIndex]] = anId;
+			++anIndex;
+		}
+	}
+	return true;
+}
+
+//=========================================================
+// Function : buildTransposedAdjacency
+// Purpose  :   
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::buildTransposedAdjacency(std::pmr::vector<size_t>& theOffsets, std::pmr::vector<NodeId>& theSources) const
+{
+	//  :       ,
+	//       .
+	theOffsets.assign(myAdjacency.size() + 1, 0);
+	for (const IdList& anIdList : myAdjacency)
+	{
+		for (NodeId anEndId : anIdList)
+		{
+			++theOffsets[anEndId + 1];
+		}
+	}
+	for (size_t i = 1; i < theOffsets.size(); ++i)
+	{
+		theOffsets[i] += theOffsets[i - 1];
+	}
+
+	theSources.resize(theOffsets.back());
+	std::pmr::vector<size_t> aPositions(theOffsets.begin(), theOffsets.end() - 1, GetMemoryResource());
+	for (NodeId aBeginId = 0; aBeginId < myAdjacency.size(); ++aBeginId)
+	{
+		for (NodeId anEndId : myAdjacency[aBeginId])
+		{
+			theSources[aPositions[anEndId]++] = aBeginId;
+		}
+	}
+}
+
+//=========================================================
+// Function : getAnyNodeId
+// Purpose  :  -  
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+typename Graph<NodeType, NodeIndex, WeightType>::NodeId Graph<NodeType, NodeIndex, WeightType>::getAnyNodeId() const
+{
+	NodeId anId = 0;
+	while (!myIsIdUsed[anId])
+	{
+		++anId;
+	}
+	return anId;
+}
+
+//=========================================================
+// Function : getIdsInNodeOrder
+// Purpose  :      
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::getIdsInNodeOrder(std::vector<NodeId>& theIds) const
+{
+	theIds.clear();
+	theIds.reserve(myNodeIndex.GetSize());
+	myNodeIndex.ForEach(myNodes, [&theIds](const NodeType&, NodeId theId) { theIds.push_back(theId); });
+	auto aNodeLess = [this](NodeId theFirstId, NodeId theSecondId) { return myNodes[theFirstId] < myNodes[theSecondId]; };
+	if (!std::is_sorted(theIds.cbegin(), theIds.cend(), aNodeLess))
+	{
+		std::sort(theIds.begin(), theIds.end(), aNodeLess);
+	}
+}
+
+//=========================================================
+// Function : countReachableNodes
+// Purpose  :  ,   
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+template<class ForEachNeighbor>
+size_t Graph<NodeType, NodeIndex, WeightType>::countReachableNodes(NodeId theRootId, ForEachNeighbor theForEachNeighbor, TraversalWorkspace& theWorkspace) const
+{
+	theWorkspace.Reset(myNodes.size());
+	theWorkspace.Visit(theRootId);
+	theWorkspace.Push(theRootId);
+
+	NodeId aCurrentId = 0;
+	while (theWorkspace.Pop(aCurrentId))
+	{
+		theForEachNeighbor(aCurrentId, [&theWorkspace](NodeId aNeighborId)
+		{
+			if (theWorkspace.Visit(aNeighborId))
+			{
+				theWorkspace.Push(aNeighborId);
+			}
+		});
+	}
+	return theWorkspace.GetPushedCount();
+}
+
+//=========================================================
+// Function : findNodeId
+// Purpose  :   
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::findNodeId(const NodeType& theNode, NodeId& theId) const
+{
+	return myNodeIndex.Find(theNode, myNodes, theId);
+}
+
+//=========================================================
+// Function : internNode
+// Purpose  :    
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+template<class Node>
+typename Graph<NodeType, NodeIndex, WeightType>::NodeId Graph<NodeType, NodeIndex, WeightType>::internNode(Node&& theNode)
+{
+	NodeId anId = 0;
+	if (!myFreeIds.empty())
+	{
+		anId = myFreeIds.back();
+		myFreeIds.pop_back();
+		myNodes[anId] = std::forward<Node>(theNode);
+		myIsIdUsed[anId] = 1;
+	}
+	else
+	{
+		anId = static_cast<NodeId>(myNodes.size());
+		myNodes.push_back(std::forward<Node>(theNode));
+		myAdjacency.emplace_back();
+		if constexpr (IsWeighted)
+		{
+			myWeights.emplace_back();
+		}
+		myIsIdUsed.push_back(1);
+		if (myIsReverseIndexEnabled)
+		{
+			myReverseAdjacency.emplace_back();
+		}
+		if (myIsWeakComponentTrackingEnabled)
+		{
+			myWeakComponents.AddElement();
+		}
+		if (myIsTopologicalOrderTrackingEnabled)
+		{
+			myTopologicalPositions.push_back(static_cast<uint32_t>(myTopologicalOrderIds.size()));
+			myTopologicalOrderIds.push_back(anId);
+		}
+	}
+	myNodeIndex.Insert(myNodes[anId], anId, myNodes); //    
+
+	//   -  .      :
+	//     ,        .
+	if (myIsWeakComponentTrackingEnabled)
+	{
+		++myWeakComponentCount;
+	}
+	return anId;
+}
+
+//=========================================================
+// Function : getSortedNodeList
+// Purpose  :   ,    
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+typename Graph<NodeType, NodeIndex, WeightType>::NodeList Graph<NodeType, NodeIndex, WeightType>::getSortedNodeList(NodeId theId) const
+{
+	NodeList aNodeList;
+	for (NodeId aNeighborId : myAdjacency[theId])
+	{
+		aNodeList.push_back(myNodes[aNeighborId]);
+	}
+	aNodeList.sort();
+	return aNodeList;
+}
+
+//=========================================================
+// Function : existsPath
+// Purpose  :      
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::existsPath(NodeId theBeginId, NodeId theEndId, TraversalWorkspace& theWorkspace) const
+{
+	//         .
+	//     :        ,
+	//    theBeginId == theEndId    .
+	theWorkspace.Reset(myNodes.size());
+	theWorkspace.Push(theBeginId);
+
+	//    
+	NodeId aCurrentId = 0;
+	while (theWorkspace.Pop(aCurrentId))
+	{
+		for (NodeId aNeighborId : myAdjacency[aCurrentId])
+		{
+			if (aNeighborId == theEndId)
+			{
+				return true;
+			}
+			//      ,        
+			if (theWorkspace.Visit(aNeighborId))
+			{
+				theWorkspace.Push(aNeighborId);
+			}
+		}
+	}
+	return false;
+}
+
+//=========================================================
+// Function : visitReachableNodes
+// Purpose  :  ,   
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+void Graph<NodeType, NodeIndex, WeightType>::visitReachableNodes(NodeId theBeginId, TraversalWorkspace& theWorkspace) const
+{
+	//    existsPath,       ,      
+	theWorkspace.Reset(myNodes.size());
+	theWorkspace.Push(theBeginId);
+
+	NodeId aCurrentId = 0;
+	while (theWorkspace.Pop(aCurrentId))
+	{
+		for (NodeId aNeighborId : myAdjacency[aCurrentId])
+		{
+			if (theWorkspace.Visit(aNeighborId))
+			{
+				theWorkspace.Push(aNeighborId);
+			}
+		}
+	}
+}
+
+//=========================================================
+// Function : existsPathDirectionOptimizing
+// Purpose  :      
+//=========================================================
+template<class NodeType, class NodeIndex, class WeightType>
+bool Graph<NodeType, NodeIndex, WeightType>::existsPathDirectionOptimizing(NodeId theBeginId, NodeId theEndId, TraversalWorkspace& theWorkspace) const
+{
+	//   (Beamer, Asanovic, Patterson, "Direction-Optimizing Breadth-First Search"):
+	//   -     1/Alpha   ,
+	//  -     1/Beta  .
+	const size_t Alpha = 14;
+	const size_t Beta = 24;
+
+	//    existsPath,       ,      
+	theWorkspace.Reset(myNodes.size());
+	std::pmr::vector<NodeId> aFrontier(1, theBeginId, GetMemoryResource());
+	std::pmr::vector<NodeId> aNext(GetMemoryResource());
+	size_t aFrontierEdgeCount = myAdjacency[theBeginId].size();
+	size_t anUnvisitedEdgeCount = myEdgeCount; // ,      
+	bool anIsTopDown = true;
+
+	//           (   )
+	std::pmr::vector<size_t> aTransposedOffsets(GetMemoryResource());
+	std::pmr::vector<NodeId> aTransposedSources(GetMemoryResource());
+	std::pmr::vector<uint64_t> anIsInFrontier(GetMemoryResource());
+
+	while (!aFrontier.empty())
+	{
+		if (anIsTopDown && aFrontierEdgeCount > anUnvisitedEdgeCount / Alpha)
+		{
+			anIsTopDown = false;
+			if (anIsInFrontier.empty())
+			{
+				anIsInFrontier.assign((myNodes.size() + 63) / 64, 0);
+				if (!myIsReverseIndexEnabled)
+				{
+					buildTransposedAdjacency(aTransposedOffsets, aTransposedSources);
+				}
+			}
+		}
+		else if (!anIsTopDown && aFrontier.size() < GetNodeCount() / Beta)
+		{
+			anIsTopDown = true;
+		}
+
+		aNext.clear();
+		aFrontierEdgeCount = 0;
+		if (anIsTopDown)
+		{
+			//   :  ,    
+			for (NodeId aCurrentId : aFrontier)
+			{
+				for (NodeId aNeighborId : myAdjacency[aCurrentId])
+				{
+					if (aNeighborId == theEndId)
+					{
+						return true;
+					}
+					if (theWorkspace.Visit(aNeighborId))
+					{
+						aNext.push_back(aNeighborId);
+						aFrontierEdgeCount += myAdjacency[aNeighborId].size();
+						anUnvisitedEdgeCount -= myAdjacency[aNeighborId].size();
+					}
+				}
+			}
+		}
+		else
+		{
+			//   :        
+			for (NodeId aCurrentId : aFrontier)
+			{
+				anIsInFrontier[aCurrentId / 64] |= uint64_t(1) << (aCurrentId % 64);
+			}
+			for (NodeId anId = 0; anId < myNodes.size(); ++anId)
+			{
+				if (!myIsIdUsed[anId] || theWorkspace.IsVisited(anId))
+					continue;
+
+				const NodeId* aPredecessor = nullptr;
+				const NodeId* aPredecessorsEnd = nullptr;
+				if (myIsReverseIndexEnabled)
+				{
+					aPredecessor = myReverseAdjacency[anId].data();
+					aPredecessorsEnd = aPredecessor + myReverseAdjacency[anId].size();
+				}
+				else
+				{
+					aPredecessor = aTransposedSources.data() + aTransposedOffsets[anId];
+					aPredecessorsEnd = aTransposedSources.data() + aTransposedOffsets[anId + 1];
+				}
+				for (; aPredecessor != aPredecessorsEnd; ++aPredecessor)
+				{
+					if ((anIsInFrontier[*aPredecessor / 64] >> (*aPredecessor % 64)) & 1)
+					{
+						if (anId == theEndId)
+						{
+							return true;
+						}
+						theWorkspace.Visit(anId);
+						aNext.push_back(anId);
+						aFrontierEdgeCount += myAdjacency[anId].size();
+						anUnvisitedEdgeCount -= myAdjacency[anId].size();
+						break;
+					}
+				}
+			}
+			for (NodeId aCurrentId : aFrontier)
+			{
+				anIsInFrontier[aCurrentId / 64] = 0;
+			}
+		}
+		aFrontier.swap(aNext);
+	}
+	return false;
 }
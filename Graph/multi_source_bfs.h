@@ -0,0 +1,131 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+//        (multi-source BFS).
+//      LaneCount     ()  64- .
+//      ,    ,     ,
+//          ,     .
+//     ,     O(    ),   O(V).
+//     :      
+// (       ,  )      .
+//   :      (. GetThreadMultiSourceBfs).
+class MultiSourceBfs
+{
+public:
+	typedef uint32_t NodeId;   //  
+	typedef uint64_t LaneMask; //  :  i      i
+
+	static constexpr size_t LaneCount = 64; //      
+
+	//    ,    theAdjacency ( -   ),
+	//   theSourceIds[0 .. theSourceCount) (theSourceCount   LaneCount;   ).
+	//      ,      - ,
+	//  theOnVisit(anId, aNewLanes, aLevel),  aLevel -    (  1).
+	//      ,           .
+	template <class AdjacencyLists, class OnVisit>
+	void Run(const AdjacencyLists& theAdjacency, const NodeId* theSourceIds, size_t theSourceCount, OnVisit theOnVisit);
+
+	//     .
+	template <class AdjacencyLists>
+	void Run(const AdjacencyLists& theAdjacency, const NodeId* theSourceIds, size_t theSourceCount)
+	{
+		Run(theAdjacency, theSourceIds, theSourceCount, [](NodeId, LaneMask, uint32_t) {});
+	}
+
+	//    ,     .
+	LaneMask GetSeenLanes(NodeId theId) const { return theId < mySeen.size() ? mySeen[theId] : 0; }
+
+private:
+	std::vector<LaneMask> mySeen;     // ,  
+	std::vector<LaneMask> myFrontier; // ,       
+	std::vector<LaneMask> myNext;     // ,       
+	std::vector<NodeId> myFrontierIds; //   
+	std::vector<NodeId> myNextIds;     //   
+	std::vector<NodeId> myTouchedIds;  //     mySeen (   )
+};
+
+//     ,   .
+inline MultiSourceBfs& GetThreadMultiSourceBfs();
+
+//=========================================================
+// Function : Run
+// Purpose  :       
+//=========================================================
+template <class AdjacencyLists, class OnVisit>
+void MultiSourceBfs::Run(const AdjacencyLists& theAdjacency, const NodeId* theSourceIds, size_t theSourceCount, OnVisit theOnVisit)
+{
+	const size_t anIdBound = theAdjacency.size();
+	if (mySeen.size() < anIdBound)
+	{
+		mySeen.resize(anIdBound, 0);
+		myFrontier.resize(anIdBound, 0);
+		myNext.resize(anIdBound, 0);
+	}
+	for (NodeId anId : myTouchedIds)
+	{
+		mySeen[anId] = 0;
+	}
+	myTouchedIds.clear();
+	myFrontierIds.clear();
+
+	//      0,    
+	for (size_t aLane = 0; aLane < theSourceCount; ++aLane)
+	{
+		const NodeId aSourceId = theSourceIds[aLane];
+		if (myFrontier[aSourceId] == 0)
+		{
+			myFrontierIds.push_back(aSourceId);
+		}
+		myFrontier[aSourceId] |= LaneMask(1) << aLane;
+	}
+
+	for (uint32_t aLevel = 1; !myFrontierIds.empty(); ++aLevel)
+	{
+		//         
+		myNextIds.clear();
+		for (NodeId anId : myFrontierIds)
+		{
+			const LaneMask aLanes = myFrontier[anId];
+			myFrontier[anId] = 0;
+			for (NodeId aNeighborId : theAdjacency[anId])
+			{
+				const LaneMask aNewLanes = aLanes & ~mySeen[aNeighborId] & ~myNext[aNeighborId];
+				if (aNewLanes != 0)
+				{
+					if (myNext[aNeighborId] == 0)
+					{
+						myNextIds.push_back(aNeighborId);
+					}
+					myNext[aNeighborId] |= aNewLanes;
+				}
+			}
+		}
+
+		//         
+		for (NodeId anId : myNextIds)
+		{
+			const LaneMask aNewLanes = myNext[anId];
+			myNext[anId] = 0;
+			if (mySeen[anId] == 0)
+			{
+				myTouchedIds.push_back(anId);
+			}
+			mySeen[anId] |= aNewLanes;
+			myFrontier[anId] = aNewLanes;
+			theOnVisit(anId, aNewLanes, aLevel);
+		}
+		myFrontierIds.swap(myNextIds);
+	}
+}
+
+//=========================================================
+// Function : GetThreadMultiSourceBfs
+// Purpose  :     
+//=========================================================
+inline MultiSourceBfs& GetThreadMultiSourceBfs()
+{
+	thread_local MultiSourceBfs aBfs;
+	return aBfs;
+}
@@ -0,0 +1,384 @@
+#pragma once
+
+#include <set>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <memory_resource>
+
+//    -  ,      .
+//      ,  ,    
+//   ,       .
+//
+//     explicit Index(std::pmr::memory_resource* theMemoryResource),
+//      theMemoryResource,   :
+//   bool Find(const NodeType& theNode, const std::pmr::vector<NodeType>& theNodes, NodeId& theId) const;
+//   void Insert(const NodeType& theNode, NodeId theId, const std::pmr::vector<NodeType>& theNodes);
+//   void Erase(const NodeType& theNode, const std::pmr::vector<NodeType>& theNodes);
+//   void Clear();
+//   size_t GetSize() const;
+//   template <class Function> void ForEach(const std::pmr::vector<NodeType>& theNodes, Function theFunction) const;
+//  theNodes[theId] -    theId,  theFunction   theFunction(aNode, anId).
+
+//      std::set  .
+//     ,      ,     .
+//    O(log V). ForEach     ,
+//       .
+template <class NodeType>
+class OrderedNodeIndex
+{
+public:
+	typedef uint32_t NodeId; //  
+
+	explicit OrderedNodeIndex(std::pmr::memory_resource* theMemoryResource = std::pmr::get_default_resource());
+
+	//    .  false,     .
+	bool Find(const NodeType& theNode, const std::pmr::vector<NodeType>& theNodes, NodeId& theId) const;
+
+	//      theNode   theId.      .
+	void Insert(const NodeType& theNode, NodeId theId, const std::pmr::vector<NodeType>& theNodes);
+
+	//     .     ,   .
+	void Erase(const NodeType& theNode, const std::pmr::vector<NodeType>& theNodes);
+
+	//      .
+	void Clear() { myNodeIds.clear(); }
+
+	//      .
+	size_t GetSize() const { return myNodeIds.size(); }
+
+	//   theFunction(aNode, anId)        .
+	template <class Function>
+	void ForEach(const std::pmr::vector<NodeType>& theNodes, Function theFunction) const;
+
+private:
+	//        (    )
+	struct NodeKey
+	{
+		const NodeType* myNode;                     //  
+		const std::pmr::vector<NodeType>* myNodes;  //   (  -  )
+	};
+
+	//    .         .
+	//        -   ,  Insert
+	//     (. insertNodes).     :  
+	//  ,     .
+	struct NodeIdLess
+	{
+		typedef void is_transparent; //    NodeKey
+
+		//       ,       .
+		static const std::pmr::vector<NodeType>*& insertNodes()
+		{
+			static thread_local const std::pmr::vector<NodeType>* aNodes = nullptr;
+			return aNodes;
+		}
+
+		bool operator()(NodeId theFirstId, NodeId theSecondId) const { return (*insertNodes())[theFirstId] < (*insertNodes())[theSecondId]; }
+		bool operator()(NodeId theId, const NodeKey& theKey) const { return (*theKey.myNodes)[theId] < *theKey.myNode; }
+		bool operator()(const NodeKey& theKey, NodeId theId) const { return *theKey.myNode < (*theKey.myNodes)[theId]; }
+	};
+
+private:
+	std::pmr::set<NodeId, NodeIdLess> myNodeIds; //      
+};
+
+//     -    ( ).
+//               ,
+//        .      O(1)
+// ,  ,         (   ).
+// ForEach      ,     .
+//   NodeType:  - Hash   KeyEqual.
+template <class NodeType, class Hash = std::hash<NodeType>, class KeyEqual = std::equal_to<NodeType>>
+class FlatHashNodeIndex
+{
+public:
+	typedef uint32_t NodeId; //  
+
+	explicit FlatHashNodeIndex(std::pmr::memory_resource* theMemoryResource = std::pmr::get_default_resource());
+
+	//    .  false,     .
+	bool Find(const NodeType& theNode, const std::pmr::vector<NodeType>& theNodes, NodeId& theId) const;
+
+	//      theNode   theId.      .
+	void Insert(const NodeType& theNode, NodeId theId, const std::pmr::vector<NodeType>& theNodes);
+
+	//     .     ,   .
+	void Erase(const NodeType& theNode, const std::pmr::vector<NodeType>& theNodes);
+
+	//      .
+	void Clear();
+
+	//      .
+	size_t GetSize() const { return mySize; }
+
+	//   theFunction(aNode, anId)        .
+	template <class Function>
+	void ForEach(const std::pmr::vector<NodeType>& theNodes, Function theFunction) const;
+
+private:
+	//  
+	struct Slot
+	{
+		NodeId myId;     //  ; EmptyId   
+		uint32_t myHash; //   (        )
+	};
+
+	static const NodeId EmptyId = 0xFFFFFFFF; //   
+
+	//    .  Hash  ,
+	//    (   )     .
+	static uint32_t hashOf(const NodeType& theNode);
+
+	//   ,    .  false,     .
+	bool findSlot(const NodeType& theNode, const std::pmr::vector<NodeType>& theNodes, size_t& theSlotIndex) const;
+
+	//       ,   ,  .
+	void placeSlot(const Slot& theSlot);
+
+	//        theSlotCount ( ).
+	void rehash(size_t theSlotCount);
+
+private:
+	std::pmr::vector<Slot> mySlots; //   (  -  )
+	size_t mySize;                  //   
+};
+
+//=========================================================
+// Function : OrderedNodeIndex
+// Purpose  :  ,    theMemoryResource
+//=========================================================
+template <class NodeType>
+OrderedNodeIndex<NodeType>::OrderedNodeIndex(std::pmr::memory_resource* theMemoryResource)
+	: myNodeIds(theMemoryResource)
+{
+}
+
+//=========================================================
+// Function : Find
+// Purpose  :   
+//=========================================================
+template <class NodeType>
+bool OrderedNodeIndex<NodeType>::Find(const NodeType& theNode, const std::pmr::vector<NodeType>& theNodes, NodeId& theId) const
+{
+	auto anIdIter = myNodeIds.find(NodeKey{ &theNode, &theNodes });
+	if (anIdIter == myNodeIds.end())
+	{
+		return false;
+	}
+	theId = *anIdIter;
+	return true;
+}
+
+//=========================================================
+// Function : Insert
+// Purpose  :    
+//=========================================================
+template <class NodeType>
+void OrderedNodeIndex<NodeType>::Insert(const NodeType&, NodeId theId, const std::pmr::vector<NodeType>& theNodes)
+{
+	NodeIdLess::insertNodes() = &theNodes; //    theId    theNodes
+	myNodeIds.insert(theId);
+}
+
+//=========================================================
+// Function : Erase
+// Purpose  :    
+//=========================================================
+template <class NodeType>
+void OrderedNodeIndex<NodeType>::Erase(const NodeType& theNode, const std::pmr::vector<NodeType>& theNodes)
+{
+	auto anIdIter = myNodeIds.find(NodeKey{ &theNode, &theNodes });
+	if (anIdIter != myNodeIds.end())
+	{
+		myNodeIds.erase(anIdIter);
+	}
+}
+
+//=========================================================
+// Function : ForEach
+// Purpose  :     
+//=========================================================
+template <class NodeType>
+template <class Function>
+void OrderedNodeIndex<NodeType>::ForEach(const std::pmr::vector<NodeType>& theNodes, Function theFunction) const
+{
+	for (NodeId anId : myNodeIds)
+	{
+		theFunction(theNodes[anId], anId);
+	}
+}
+
+//=========================================================
+// Function : FlatHashNodeIndex
+// Purpose  :  ,    theMemoryResource
+//=========================================================
+template <class NodeType, class Hash, class KeyEqual>
+FlatHashNodeIndex<NodeType, Hash, KeyEqual>::FlatHashNodeIndex(std::pmr::memory_resource* theMemoryResource)
+	: mySlots(theMemoryResource), mySize(0)
+{
+}
+
+//=========================================================
+// Function : Find
+// Purpose  :   
+//=========================================================
+template <class NodeType, class Hash, class KeyEqual>
+bool FlatHashNodeIndex<NodeType, Hash, KeyEqual>::Find(const NodeType& theNode, const std::pmr::vector<NodeType>& theNodes, NodeId& theId) const
+{
+	size_t aSlotIndex = 0;
+	if (!findSlot(theNode, theNodes, aSlotIndex))
+	{
+		return false;
+	}
+	theId = mySlots[aSlotIndex].myId;
+	return true;
+}
+
+//=========================================================
+// Function : Insert
+// Purpose  :    
+//=========================================================
+template <class NodeType, class Hash, class KeyEqual>
+void FlatHashNodeIndex<NodeType, Hash, KeyEqual>::Insert(const NodeType& theNode, NodeId theId, const std::pmr::vector<NodeType>&)
+{
+	//      3/4
+	if ((mySize + 1) * 4 > mySlots.size() * 3)
+	{
+		rehash(mySlots.empty() ? 16 : mySlots.size() * 2);
+	}
+	placeSlot(Slot{ theId, hashOf(theNode) });
+	++mySize;
+}
+
+//=========================================================
+// Function : Erase
+// Purpose  :    
+//=========================================================
+template <class NodeType, class Hash, class KeyEqual>
+void FlatHashNodeIndex<NodeType, Hash, KeyEqual>::Erase(const NodeType& theNode, const std::pmr::vector<NodeType>& theNodes)
+{
+	size_t aHole = 0;
+	if (!findSlot(theNode, theNodes, aHole))
+	{
+		return;
+	}
+
+	//   :         ,
+	//      ""      .
+	const size_t aMask = mySlots.size() - 1;
+	for (size_t aNext = (aHole + 1) & aMask; mySlots[aNext].myId != EmptyId; aNext = (aNext + 1) & aMask)
+	{
+		const size_t aHome = mySlots[aNext].myHash & aMask; // ,      
+		//     aHole,   aHome      (aHole, aNext]
+		const bool aHomeIsBetween = (aHole <= aNext) ? (aHole < aHome && aHome <= aNext)
+		                                             : (aHole < aHome || aHome <= aNext);
+		if (!aHomeIsBetween)
+		{
+			mySlots[aHole] = mySlots[aNext];
+			aHole = aNext;
+		}
+	}
+	mySlots[aHole].myId = EmptyId;
+	--mySize;
+}
+
+//=========================================================
+// Function : Clear
+// Purpose  :     
+//=========================================================
+template <class NodeType, class Hash, class KeyEqual>
+void FlatHashNodeIndex<NodeType, Hash, KeyEqual>::Clear()
+{
+	mySlots.clear();
+	mySize = 0;
+}
+
+//=========================================================
+// Function : ForEach
+// Purpose  :      
+//=========================================================
+template <class NodeType, class Hash, class KeyEqual>
+template <class Function>
+void FlatHashNodeIndex<NodeType, Hash, KeyEqual>::ForEach(const std::pmr::vector<NodeType>& theNodes, Function theFunction) const
+{
+	for (const Slot& aSlot : mySlots)
+	{
+		if (aSlot.myId != EmptyId)
+		{
+			theFunction(theNodes[aSlot.myId], aSlot.myId);
+		}
+	}
+}
+
+//=========================================================
+// Function : hashOf
+// Purpose  :    
+//=========================================================
+template <class NodeType, class Hash, class KeyEqual>
+uint32_t FlatHashNodeIndex<NodeType, Hash, KeyEqual>::hashOf(const NodeType& theNode)
+{
+	const uint64_t aHash = static_cast<uint64_t>(Hash()(theNode));
+	return static_cast<uint32_t>((aHash * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+//=========================================================
+// Function : findSlot
+// Purpose  :  ,    
+//=========================================================
+template <class NodeType, class Hash, class KeyEqual>
+bool FlatHashNodeIndex<NodeType, Hash, KeyEqual>::findSlot(const NodeType& theNode, const std::pmr::vector<NodeType>& theNodes, size_t& theSlotIndex) const
+{
+	if (mySlots.empty())
+	{
+		return false;
+	}
+
+	const uint32_t aHash = hashOf(theNode);
+	const size_t aMask = mySlots.size() - 1;
+	//     ,       
+	for (size_t i = aHash & aMask; mySlots[i].myId != EmptyId; i = (i + 1) & aMask)
+	{
+		const Slot& aSlot = mySlots[i];
+		if (aSlot.myHash == aHash && KeyEqual()(theNodes[aSlot.myId], theNode))
+		{
+			theSlotIndex = i;
+			return true;
+		}
+	}
+	return false;
+}
+
+//=========================================================
+// Function : placeSlot
+// Purpose  :    
+//=========================================================
+template <class NodeType, class Hash, class KeyEqual>
+void FlatHashNodeIndex<NodeType, Hash, KeyEqual>::placeSlot(const Slot& theSlot)
+{
+	const size_t aMask = mySlots.size() - 1;
+	size_t i = theSlot.myHash & aMask;
+	while (mySlots[i].myId != EmptyId)
+	{
+		i = (i + 1) & aMask;
+	}
+	mySlots[i] = theSlot;
+}
+
+//=========================================================
+// Function : rehash
+// Purpose  :  
+//=========================================================
+template <class NodeType, class Hash, class KeyEqual>
+void FlatHashNodeIndex<NodeType, Hash, KeyEqual>::rehash(size_t theSlotCount)
+{
+	std::pmr::vector<Slot> anOldSlots(theSlotCount, Slot{ EmptyId, 0 }, mySlots.get_allocator());
+	anOldSlots.swap(mySlots);
+	for (const Slot& aSlot : anOldSlots)
+	{
+		if (aSlot.myId != EmptyId)
+		{
+			placeSlot(aSlot); //    ,     
+		}
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+//   ,        (,    ).
+//  -  ,       ,   ,
+//        :     .
+//   (Set)   ,      .
+//      .
+class OutdatedFlag
+{
+public:
+	explicit OutdatedFlag(bool theIsSet = false) : myIsSet(theIsSet) {}
+	OutdatedFlag(const OutdatedFlag& theFlag) : myIsSet(theFlag.IsSet()) {}
+	OutdatedFlag& operator=(const OutdatedFlag& theFlag);
+
+	//   true,   .
+	bool IsSet() const { return myIsSet.load(std::memory_order_acquire); }
+
+	//     .
+	void Set(bool theIsSet) { myIsSet.store(theIsSet, std::memory_order_release); }
+
+	//      theRebuild()   .
+	// ,   ,   .
+	//  theRebuild  ,   .
+	template <class Rebuild>
+	void Update(Rebuild theRebuild);
+
+private:
+	std::atomic<bool> myIsSet; //  
+	std::mutex myMutex;        //    
+};
+
+//=========================================================
+// Function : operator=
+// Purpose  : Assignment operator
+//=========================================================
+inline OutdatedFlag& OutdatedFlag::operator=(const OutdatedFlag& theFlag)
+{
+	Set(theFlag.IsSet());
+	return *this;
+}
+
+//=========================================================
+// Function : Update
+// Purpose  :   
+//=========================================================
+template <class Rebuild>
+void OutdatedFlag::Update(Rebuild theRebuild)
+{
+	if (!IsSet())
+		return;
+
+	std::lock_guard<std::mutex> aLock(myMutex);
+	if (myIsSet.load(std::memory_order_relaxed))
+	{
+		theRebuild();
+		Set(false); // ,   ,    
+	}
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+
+//   (pairing heap)      KeyType   .
+//     ,        ,
+//  ,       .
+//       O(1),   -   O(log n),
+//    :      ,  .
+//     :     
+// (      ,  ).
+template <class KeyType>
+class PairingHeap
+{
+public:
+	typedef uint32_t NodeId; //  
+
+	//         theIdBound.
+	void Reset(size_t theIdBound);
+
+	//   true,   .
+	bool IsEmpty() const { return myRoot == NoNode; }
+
+	//   true,     .
+	bool Contains(NodeId theId) const { return myIsInHeap[theId] != 0; }
+
+	//    ,    (   - ,     ).
+	const KeyType& GetKey(NodeId theId) const { return myKeys[theId]; }
+
+	//     ,    .
+	void Push(NodeId theId, const KeyType& theKey);
+
+	//    ,    (theKey    ).
+	void DecreaseKey(NodeId theId, const KeyType& theKey);
+
+	//        .     .
+	NodeId Pop();
+
+private:
+	static constexpr NodeId NoNode = 0xFFFFFFFF; //  
+
+	//        .
+	NodeId meld(NodeId theFirstRoot, NodeId theSecondRoot);
+
+	//     theId (  )     .
+	void cut(NodeId theId);
+
+private:
+	std::vector<KeyType> myKeys;       //  
+	std::vector<NodeId> myChildren;    //   
+	std::vector<NodeId> mySiblings;    //   
+	std::vector<NodeId> myPrevious;    //    (   - )
+	std::vector<char> myIsInHeap;      //  ,     
+	std::vector<NodeId> myPairs;       //      
+	NodeId myRoot = NoNode;            //   (   )
+};
+
+//        KeyType,   .
+template <class KeyType>
+PairingHeap<KeyType>& GetThreadPairingHeap();
+
+//=========================================================
+// Function : Reset
+// Purpose  :  
+//=========================================================
+template <class KeyType>
+void PairingHeap<KeyType>::Reset(size_t theIdBound)
+{
+	//       ;   
+	if (myRoot != NoNode || myIsInHeap.size() < theIdBound)
+	{
+		myIsInHeap.assign(std::max(theIdBound, myIsInHeap.size()), 0);
+	}
+	if (myKeys.size() < theIdBound)
+	{
+		myKeys.resize(theIdBound);
+		myChildren.resize(theIdBound);
+		mySiblings.resize(theIdBound);
+		myPrevious.resize(theIdBound);
+	}
+	myRoot = NoNode;
+}
+
+//=========================================================
+// Function : Push
+// Purpose  :    
+//=========================================================
+template <class KeyType>
+void PairingHeap<KeyType>::Push(NodeId theId, const KeyType& theKey)
+{
+	myKeys[theId] = theKey;
+	myChildren[theId] = mySiblings[theId] = myPrevious[theId] = NoNode;
+	myIsInHeap[theId] = 1;
+	myRoot = meld(myRoot, theId);
+}
+
+//=========================================================
+// Function : DecreaseKey
+// Purpose  :   
+//=========================================================
+template <class KeyType>
+void PairingHeap<KeyType>::DecreaseKey(NodeId theId, const KeyType& theKey)
+{
+	myKeys[theId] = theKey;
+	if (theId != myRoot)
+	{
+		//     -      
+		cut(theId);
+		myRoot = meld(myRoot, theId);
+	}
+}
+
+//=========================================================
+// Function : Pop
+// Purpose  :     
+//=========================================================
+template <class KeyType>
+typename PairingHeap<KeyType>::NodeId PairingHeap<KeyType>::Pop()
+{
+	const NodeId aMinId = myRoot;
+	myIsInHeap[aMinId] = 0;
+
+	//    :    ,    
+	myPairs.clear();
+	NodeId aChildId = myChildren[aMinId];
+	while (aChildId != NoNode)
+	{
+		const NodeId aFirstId = aChildId;
+		const NodeId aSecondId = mySiblings[aFirstId];
+		aChildId = aSecondId != NoNode ? mySiblings[aSecondId] : NoNode;
+		mySiblings[aFirstId] = myPrevious[aFirstId] = NoNode;
+		if (aSecondId != NoNode)
+		{
+			mySiblings[aSecondId] = myPrevious[aSecondId] = NoNode;
+		}
+		myPairs.push_back(meld(aFirstId, aSecondId));
+	}
+
+	myRoot = NoNode;
+	while (!myPairs.empty())
+	{
+		myRoot = meld(myPairs.back(), myRoot);
+		myPairs.pop_back();
+	}
+	return aMinId;
+}
+
+//=========================================================
+// Function : meld
+// Purpose  :   
+//=========================================================
+template <class KeyType>
+typename PairingHeap<KeyType>::NodeId PairingHeap<KeyType>::meld(NodeId theFirstRoot, NodeId theSecondRoot)
+{
+	if (theFirstRoot == NoNode)
+		return theSecondRoot;
+	if (theSecondRoot == NoNode)
+		return theFirstRoot;
+
+	//         
+	NodeId aParentId = theFirstRoot;
+	NodeId aChildId = theSecondRoot;
+	if (myKeys[aChildId] < myKeys[aParentId])
+	{
+		std::swap(aParentId, aChildId);
+	}
+	mySiblings[aChildId] = myChildren[aParentId];
+	if (myChildren[aParentId] != NoNode)
+	{
+		myPrevious[myChildren[aParentId]] = aChildId;
+	}
+	myPrevious[aChildId] = aParentId;
+	myChildren[aParentId] = aChildId;
+	return aParentId;
+}
+
+//=========================================================
+// Function : cut
+// Purpose  :       
+//=========================================================
+template <class KeyType>
+void PairingHeap<KeyType>::cut(NodeId theId)
+{
+	const NodeId aPreviousId = myPrevious[theId];
+	if (myChildren[aPreviousId] == theId)
+	{
+		myChildren[aPreviousId] = mySiblings[theId]; //  -  
+	}
+	else
+	{
+		mySiblings[aPreviousId] = mySiblings[theId];
+	}
+	if (mySiblings[theId] != NoNode)
+	{
+		myPrevious[mySiblings[theId]] = aPreviousId;
+	}
+	mySiblings[theId] = myPrevious[theId] = NoNode;
+}
+
+//=========================================================
+// Function : GetThreadPairingHeap
+// Purpose  :    
+//=========================================================
+template <class KeyType>
+PairingHeap<KeyType>& GetThreadPairingHeap()
+{
+	thread_local PairingHeap<KeyType> aHeap;
+	return aHeap;
+}
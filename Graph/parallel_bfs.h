@@ -0,0 +1,137 @@
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+
+#include "thread_barrier.h"
+#include "thread_pool.h"
+
+//      .
+//      ,      .
+//          "  ",
+//          .     
+//   ,         .
+//       (. thread_pool.h),       .
+//         ,      MinNodesPerThread
+//      ,    2 * MinNodesPerThread     .
+//      (. IsVisited)   .
+class ParallelBfs
+{
+public:
+	typedef uint32_t NodeId; //  
+
+	static constexpr NodeId NoNode = 0xFFFFFFFF; //   (,    )
+
+	static constexpr size_t MinNodesPerThread = 16384; //        
+
+	// . theThreadCount -    (0 -   ,   
+	//    MinNodesPerThread  ).
+	explicit ParallelBfs(size_t theThreadCount = 0) : myThreadCount(theThreadCount) {}
+
+	//      theBeginId      theIdBound.
+	// theForEachNeighbor(anId, aFunction)   aFunction(aNeighborId)     anId;
+	//      .
+	//  theIsBeginVisited ,   ,           
+	// (  Graph::ExistsPathBetweenTwoNodes).    ,     theStopId.
+	//    .
+	template <class ForEachNeighbor>
+	size_t Run(NodeId theBeginId, size_t theIdBound, ForEachNeighbor theForEachNeighbor,
+	           bool theIsBeginVisited, NodeId theStopId = NoNode);
+
+	//   true,       .
+	bool IsVisited(NodeId theId) const
+	{
+		return (myVisited[theId / 64].load(std::memory_order_relaxed) >> (theId % 64)) & 1;
+	}
+
+private:
+	//   .  true,       .
+	bool visit(NodeId theId)
+	{
+		const uint64_t aBit = uint64_t(1) << (theId % 64);
+		return (myVisited[theId / 64].fetch_or(aBit, std::memory_order_relaxed) & aBit) == 0;
+	}
+
+private:
+	static constexpr size_t ChunkSize = 256; //   ,     
+
+	size_t myThreadCount;                          //    (0 -   )
+	std::vector<std::atomic<uint64_t>> myVisited;  //    
+};
+
+//=========================================================
+// Function : Run
+// Purpose  :    
+//=========================================================
+template <class ForEachNeighbor>
+size_t ParallelBfs::Run(NodeId theBeginId, size_t theIdBound, ForEachNeighbor theForEachNeighbor,
+                        bool theIsBeginVisited, NodeId theStopId)
+{
+	myVisited = std::vector<std::atomic<uint64_t>>((theIdBound + 63) / 64);
+	const size_t aThreadCount = myThreadCount != 0 ? myThreadCount
+		: std::max<size_t>(1, std::min(ThreadPool::GetDefaultThreadCount(), theIdBound / MinNodesPerThread));
+
+	std::vector<NodeId> aFrontier(1, theBeginId);
+	std::vector<std::vector<NodeId>> aLocalNexts(aThreadCount); //    (   )
+	std::atomic<size_t> aNextChunk(0);
+	std::atomic<bool> anIsStopReached(false);
+	size_t aVisitedCount = 0;
+	bool anIsFinished = false;
+	if (theIsBeginVisited)
+	{
+		visit(theBeginId);
+		aVisitedCount = 1;
+	}
+
+	ThreadBarrier aBarrier(aThreadCount);
+	auto aWork = [&](size_t theThreadIndex)
+	{
+		std::vector<NodeId>& aLocalNext = aLocalNexts[theThreadIndex];
+		while (true)
+		{
+			//    
+			for (size_t aChunk = aNextChunk++; aChunk * ChunkSize < aFrontier.size(); aChunk = aNextChunk++)
+			{
+				const size_t anEnd = std::min(aFrontier.size(), (aChunk + 1) * ChunkSize);
+				for (size_t i = aChunk * ChunkSize; i < anEnd; ++i)
+				{
+					theForEachNeighbor(aFrontier[i], [&](NodeId aNeighborId)
+					{
+						if (visit(aNeighborId))
+						{
+							aLocalNext.push_back(aNeighborId);
+							if (aNeighborId == theStopId)
+							{
+								anIsStopReached.store(true, std::memory_order_relaxed);
+							}
+						}
+					});
+				}
+			}
+			aBarrier.Wait();
+
+			//      (  ,    )
+			if (theThreadIndex == 0)
+			{
+				aFrontier.clear();
+				for (std::vector<NodeId>& aBuffer : aLocalNexts)
+				{
+					aFrontier.insert(aFrontier.end(), aBuffer.begin(), aBuffer.end());
+					aBuffer.clear();
+				}
+				aVisitedCount += aFrontier.size();
+				aNextChunk = 0;
+				anIsFinished = aFrontier.empty() || anIsStopReached.load(std::memory_order_relaxed);
+			}
+			aBarrier.Wait();
+
+			if (anIsFinished)
+				return;
+		}
+	};
+
+	GetThreadPool().Run(aThreadCount, aWork, &aBarrier); //   -    
+	return aVisitedCount;
+}
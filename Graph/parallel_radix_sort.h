@@ -0,0 +1,112 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+
+#include "thread_barrier.h"
+#include "thread_pool.h"
+
+//     (LSD radix sort)   64- .
+//        ,   .   ,
+//      (. theKeyMask), ,      
+//   N    2 * ceil(log2(N) / 8) ,    8.
+//       .       ,
+//     ,    ,      .
+//     ,   .
+//       (. thread_pool.h),      ;
+//       MinRecordsPerThread ,      .
+class ParallelRadixSort
+{
+public:
+	// . theThreadCount -     (0 -   ).
+	explicit ParallelRadixSort(size_t theThreadCount = 0)
+		: myThreadCount(theThreadCount != 0 ? theThreadCount : ThreadPool::GetDefaultThreadCount())
+	{
+	}
+
+	//     theRecords    theKeyOf(aRecord) (uint64_t).
+	//         theKeyMask.
+	//              .
+	template <class Record, class Allocator, class KeyOf>
+	void Sort(std::vector<Record, Allocator>& theRecords, uint64_t theKeyMask, KeyOf theKeyOf) const;
+
+private:
+	static constexpr size_t RadixBits = 8;                    //   ,   
+	static constexpr size_t RadixSize = size_t(1) << RadixBits; //   
+	static constexpr size_t MinRecordsPerThread = 1 << 14;    //      
+
+	size_t myThreadCount; //    
+};
+
+//=========================================================
+// Function : Sort
+// Purpose  :   
+//=========================================================
+template <class Record, class Allocator, class KeyOf>
+void ParallelRadixSort::Sort(std::vector<Record, Allocator>& theRecords, uint64_t theKeyMask, KeyOf theKeyOf) const
+{
+	std::vector<size_t> aShifts; //   ,    
+	for (size_t aShift = 0; aShift < 64; aShift += RadixBits)
+	{
+		if (((theKeyMask >> aShift) & (RadixSize - 1)) != 0)
+		{
+			aShifts.push_back(aShift);
+		}
+	}
+	const size_t aSize = theRecords.size();
+	if (aShifts.empty() || aSize < 2)
+		return;
+
+	const size_t aThreadCount = std::max<size_t>(1, std::min(myThreadCount, aSize / MinRecordsPerThread));
+	std::vector<Record, Allocator> aBuffer(aSize, theRecords.get_allocator());
+	std::vector<size_t> aCounts(aThreadCount * RadixSize); //  : aCounts[aThread * RadixSize + aDigit]
+
+	ThreadBarrier aBarrier(aThreadCount);
+	auto aWork = [&](size_t theThreadIndex)
+	{
+		const size_t aBegin = aSize * theThreadIndex / aThreadCount;
+		const size_t anEnd = aSize * (theThreadIndex + 1) / aThreadCount;
+		size_t* aCount = &aCounts[theThreadIndex * RadixSize];
+		size_t anOffsets[RadixSize];
+		Record* aSource = theRecords.data();
+		Record* aTarget = aBuffer.data();
+		for (size_t aShift : aShifts)
+		{
+			std::fill(aCount, aCount + RadixSize, size_t(0));
+			for (size_t i = aBegin; i < anEnd; ++i)
+			{
+				++aCount[(theKeyOf(aSource[i]) >> aShift) & (RadixSize - 1)];
+			}
+			aBarrier.Wait();
+
+			//     d           d  
+			size_t anOffset = 0;
+			for (size_t aDigit = 0; aDigit < RadixSize; ++aDigit)
+			{
+				for (size_t aThread = 0; aThread < aThreadCount; ++aThread)
+				{
+					if (aThread == theThreadIndex)
+					{
+						anOffsets[aDigit] = anOffset;
+					}
+					anOffset += aCounts[aThread * RadixSize + aDigit];
+				}
+			}
+			for (size_t i = aBegin; i < anEnd; ++i)
+			{
+				aTarget[anOffsets[(theKeyOf(aSource[i]) >> aShift) & (RadixSize - 1)]++] = std::move(aSource[i]);
+			}
+			aBarrier.Wait(); //           
+			std::swap(aSource, aTarget);
+		}
+	};
+
+	GetThreadPool().Run(aThreadCount, aWork, &aBarrier); //   -    
+
+	if (aShifts.size() % 2 != 0)
+	{
+		theRecords.swap(aBuffer); //         
+	}
+}
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+
+#include "strong_components.h"
+#include "traversal_workspace.h"
+
+//  :    "       "   .
+//      (. strong_components.h):     
+//    ,      .
+//       C:
+// -  C   ,      -   C   .
+//      O(1),  - C * C / 8 ;
+// -           .
+//        ,  GRAIL -  .
+//        O(1);  -  , 
+//    .  - O(C).
+//   :       .
+class ReachabilityIndex
+{
+public:
+	typedef uint32_t NodeId; //   (. Graph::GetNodeId)
+
+	static constexpr size_t DefaultMaxClosureComponentCount = 8192; //      (8 )
+
+	//   .
+	ReachabilityIndex() = default;
+
+	//    ,    theAdjacency ( -   ),
+	//    anId,   theIsIdUsed[anId] .
+	//   ,      theMaxClosureComponentCount.
+	template <class AdjacencyLists, class UsedIdMask>
+	ReachabilityIndex(const AdjacencyLists& theAdjacency, const UsedIdMask& theIsIdUsed,
+	                  size_t theMaxClosureComponentCount = DefaultMaxClosureComponentCount);
+
+	//   true,    theBeginId   theEndId       
+	// (. Graph::ExistsPathBetweenTwoNodes). ,      ,
+	//   .   (  )    theWorkspace.
+	bool Reaches(NodeId theBeginId, NodeId theEndId, TraversalWorkspace& theWorkspace) const;
+
+	//  ,      .
+	bool Reaches(NodeId theBeginId, NodeId theEndId) const { return Reaches(theBeginId, theEndId, GetThreadTraversalWorkspace()); }
+
+	//   true,      ( -  ).
+	bool HasClosure() const { return !myClosure.empty(); }
+
+private:
+	typedef StrongComponents::ComponentId ComponentId;
+
+	//   GRAIL:    u   v,   v    u.
+	struct Label
+	{
+		uint32_t myLow;  //      
+		uint32_t myPost; //        
+	};
+
+	//      .
+	void buildClosure();
+
+	//         .
+	//  theIsReversed       (    GRAIL).
+	//  theTreeBegins  ,     theTreeEnds    .
+	void buildLabels(bool theIsReversed, std::vector<Label>& theLabels,
+	                 std::vector<uint32_t>* theTreeBegins, std::vector<uint32_t>* theTreeEnds) const;
+
+	//   true,   ,    theBeginId  theEndId .
+	bool isCutByLabels(ComponentId theBeginId, ComponentId theEndId) const;
+
+	//   true,  theEndId    theBeginId   (  ).
+	bool isInTreeInterval(ComponentId theBeginId, ComponentId theEndId) const
+	{
+		return myTreeBegins[theBeginId] <= myTreeBegins[theEndId] && myTreeBegins[theEndId] <= myTreeEnds[theBeginId];
+	}
+
+private:
+	StrongComponents myComponents;              //      
+	                                            // (  -   )
+	std::vector<char> myIsComponentCyclic;      //  ,      ( )
+
+	size_t myClosureRowWordCount = 0;           //  64-    
+	std::vector<uint64_t> myClosure;            //  :  v  u -  v   u
+
+	std::vector<Label> myLabels[2];             //    GRAIL (,   )
+	std::vector<uint32_t> myTreeBegins;         //        
+	std::vector<uint32_t> myTreeEnds;           //      
+};
+
+//=========================================================
+// Function : ReachabilityIndex
+// Purpose  :   
+//=========================================================
+template <class AdjacencyLists, class UsedIdMask>
+ReachabilityIndex::ReachabilityIndex(const AdjacencyLists& theAdjacency, const UsedIdMask& theIsIdUsed,
+                                     size_t theMaxClosureComponentCount)
+	: myComponents(theAdjacency, theIsIdUsed)
+{
+	const size_t aComponentCount = myComponents.GetComponentCount();
+
+	//       ;     -      .
+	myIsComponentCyclic.assign(aComponentCount, 0);
+	for (NodeId anId = 0; anId < theAdjacency.size(); ++anId)
+	{
+		if (!theIsIdUsed[anId])
+			continue;
+		const ComponentId aComponentId = myComponents.GetComponentId(anId);
+		if (myComponents.GetComponentSize(aComponentId) > 1
+			|| std::find(theAdjacency[anId].begin(), theAdjacency[anId].end(), anId) != theAdjacency[anId].end())
+		{
+			myIsComponentCyclic[aComponentId] = 1;
+		}
+	}
+
+	if (aComponentCount <= theMaxClosureComponentCount)
+	{
+		buildClosure();
+	}
+	else
+	{
+		buildLabels(false, myLabels[0], &myTreeBegins, &myTreeEnds);
+		buildLabels(true, myLabels[1], nullptr, nullptr);
+	}
+}
+
+//=========================================================
+// Function : Reaches
+// Purpose  : ,      
+//=========================================================
+inline bool ReachabilityIndex::Reaches(NodeId theBeginId, NodeId theEndId, TraversalWorkspace& theWorkspace) const
+{
+	const size_t anIdBound = myComponents.GetNodeIdBound();
+	if (theBeginId >= anIdBound || theEndId >= anIdBound)
+		return false;
+
+	const ComponentId aBeginId = myComponents.GetComponentId(theBeginId);
+	const ComponentId anEndId = myComponents.GetComponentId(theEndId);
+	if (aBeginId == StrongComponents::NoComponent || anEndId == StrongComponents::NoComponent)
+		return false;
+
+	//       ,      -     
+	if (aBeginId == anEndId)
+		return theBeginId != theEndId || myIsComponentCyclic[aBeginId];
+
+	//        
+	if (aBeginId > anEndId)
+		return false;
+
+	if (HasClosure())
+		return (myClosure[aBeginId * myClosureRowWordCount + anEndId / 64] >> (anEndId % 64)) & 1;
+
+	if (isCutByLabels(aBeginId, anEndId))
+		return false;
+	if (isInTreeInterval(aBeginId, anEndId))
+		return true;
+
+	//     -  ,    ,
+	//      .
+	theWorkspace.Reset(myComponents.GetComponentCount());
+	theWorkspace.Visit(aBeginId);
+	theWorkspace.Push(aBeginId);
+	ComponentId aCurrentId = 0;
+	while (theWorkspace.Pop(aCurrentId))
+	{
+		for (size_t i = 0; i < myComponents.GetSuccessorComponentCount(aCurrentId); ++i)
+		{
+			const ComponentId aSuccessorId = myComponents.GetSuccessorComponent(aCurrentId, i);
+			if (aSuccessorId == anEndId || (aSuccessorId < anEndId && isInTreeInterval(aSuccessorId, anEndId)))
+				return true;
+			if (aSuccessorId < anEndId && !isCutByLabels(aSuccessorId, anEndId) && theWorkspace.Visit(aSuccessorId))
+			{
+				theWorkspace.Push(aSuccessorId);
+			}
+		}
+	}
+	return false;
+}
+
+//=========================================================
+// Function : buildClosure
+// Purpose  :     
+//=========================================================
+inline void ReachabilityIndex::buildClosure()
+{
+	const size_t aComponentCount = myComponents.GetComponentCount();
+	myClosureRowWordCount = (aComponentCount + 63) / 64;
+	myClosure.assign(aComponentCount * myClosureRowWordCount, 0);
+
+	//      ,     
+	//  :   -      .
+	for (size_t aComponentId = aComponentCount; aComponentId-- > 0;)
+	{
+		uint64_t* aRow = myClosure.data() + aComponentId * myClosureRowWordCount;
+		for (size_t i = 0; i < myComponents.GetSuccessorComponentCount(static_cast<ComponentId>(aComponentId)); ++i)
+		{
+			const ComponentId aSuccessorId = myComponents.GetSuccessorComponent(static_cast<ComponentId>(aComponentId), i);
+			aRow[aSuccessorId / 64] |= uint64_t(1) << (aSuccessorId % 64);
+
+			//          
+			const uint64_t* aSuccessorRow = myClosure.data() + aSuccessorId * myClosureRowWordCount;
+			for (size_t aWord = aSuccessorId / 64; aWord < myClosureRowWordCount; ++aWord)
+			{
+				aRow[aWord] |= aSuccessorRow[aWord];
+			}
+		}
+	}
+}
+
+//=========================================================
+// Function : buildLabels
+// Purpose  :   
+//=========================================================
+inline void ReachabilityIndex::buildLabels(bool theIsReversed, std::vector<Label>& theLabels,
+                                           std::vector<uint32_t>* theTreeBegins, std::vector<uint32_t>* theTreeEnds) const
+{
+	const size_t aComponentCount = myComponents.GetComponentCount();
+	const uint32_t NotVisited = 0xFFFFFFFF;
+	theLabels.assign(aComponentCount, Label{ NotVisited, NotVisited });
+	if (theTreeBegins)
+	{
+		theTreeBegins->assign(aComponentCount, 0);
+		theTreeEnds->assign(aComponentCount, 0);
+	}
+
+	//    :   -       .
+	std::vector<std::pair<ComponentId, size_t>> aStack;
+	std::vector<char> aVisited(aComponentCount, 0);
+	uint32_t aNextPre = 0;
+	uint32_t aNextPost = 0;
+	for (ComponentId aRootId = 0; aRootId < aComponentCount; ++aRootId)
+	{
+		if (aVisited[aRootId])
+			continue;
+
+		aVisited[aRootId] = 1;
+		if (theTreeBegins)
+			(*theTreeBegins)[aRootId] = aNextPre++;
+		aStack.emplace_back(aRootId, 0);
+
+		while (!aStack.empty())
+		{
+			const ComponentId aCurrentId = aStack.back().first;
+			const size_t aCount = myComponents.GetSuccessorComponentCount(aCurrentId);
+			size_t& aPosition = aStack.back().second;
+			if (aPosition < aCount)
+			{
+				const size_t anIndex = theIsReversed ? aCount - 1 - aPosition : aPosition;
+				++aPosition;
+				const ComponentId aSuccessorId = myComponents.GetSuccessorComponent(aCurrentId, anIndex);
+				if (!aVisited[aSuccessorId])
+				{
+					aVisited[aSuccessorId] = 1;
+					if (theTreeBegins)
+						(*theTreeBegins)[aSuccessorId] = aNextPre++;
+					aStack.emplace_back(aSuccessorId, 0);
+				}
+				continue;
+			}
+
+			//   :       (  )
+			aStack.pop_back();
+			Label& aLabel = theLabels[aCurrentId];
+			aLabel.myPost = aNextPost++;
+			aLabel.myLow = aLabel.myPost;
+			for (size_t i = 0; i < aCount; ++i)
+			{
+				aLabel.myLow = std::min(aLabel.myLow, theLabels[myComponents.GetSuccessorComponent(aCurrentId, i)].myLow);
+			}
+			if (theTreeBegins)
+				(*theTreeEnds)[aCurrentId] = aNextPre - 1;
+		}
+	}
+}
+
+//=========================================================
+// Function : isCutByLabels
+// Purpose  :    
+//=========================================================
+inline bool ReachabilityIndex::isCutByLabels(ComponentId theBeginId, ComponentId theEndId) const
+{
+	for (const std::vector<Label>& aLabels : myLabels)
+	{
+		const Label& aBegin = aLabels[theBeginId];
+		const Label& anEnd = aLabels[theEndId];
+		if (anEnd.myLow < aBegin.myLow || anEnd.myPost > aBegin.myPost)
+			return true;
+	}
+	return false;
+}
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+
+//         .
+//      ,       .
+//       :   
+//           .
+//      O(V + E),    "     "
+//      O(1).
+//   :       .
+class StrongComponents
+{
+public:
+	typedef uint32_t NodeId;      //   (. Graph::GetNodeId)
+	typedef uint32_t ComponentId; //  
+
+	static constexpr ComponentId NoComponent = 0xFFFFFFFF; //     
+
+	//   .
+	StrongComponents() = default;
+
+	//    ,    theAdjacency ( -   ),
+	//    anId,   theIsIdUsed[anId] .
+	//    ,       .
+	template <class AdjacencyLists, class UsedIdMask>
+	StrongComponents(const AdjacencyLists& theAdjacency, const UsedIdMask& theIsIdUsed);
+
+	//      ,    .
+	size_t GetNodeIdBound() const { return myComponentIds.size(); }
+
+	//    .
+	size_t GetComponentCount() const { return myComponentSizes.size(); }
+
+	//      (NoComponent,     ).
+	ComponentId GetComponentId(NodeId theId) const { return myComponentIds[theId]; }
+
+	//      .
+	size_t GetComponentSize(ComponentId theComponentId) const { return myComponentSizes[theComponentId]; }
+
+	//   true,       (     ).
+	bool AreStronglyConnected(NodeId theFirstId, NodeId theSecondId) const
+	{
+		return myComponentIds[theFirstId] == myComponentIds[theSecondId];
+	}
+
+	//      .
+	size_t GetCondensationEdgeCount() const { return myCondensationTargets.size(); }
+
+	//   theFunction(aSuccessorId)   ,     
+	//   theComponentId.     .
+	template <class Function>
+	void ForEachSuccessorComponent(ComponentId theComponentId, Function theFunction) const;
+
+	//     ,    theComponentId.
+	size_t GetSuccessorComponentCount(ComponentId theComponentId) const
+	{
+		return myCondensationOffsets[theComponentId + 1] - myCondensationOffsets[theComponentId];
+	}
+
+	//       theIndex  ,    
+	//    theComponentId (  ForEachSuccessorComponent).
+	ComponentId GetSuccessorComponent(ComponentId theComponentId, size_t theIndex) const
+	{
+		return myCondensationTargets[myCondensationOffsets[theComponentId] + theIndex];
+	}
+
+private:
+	//          .
+	template <class AdjacencyLists, class UsedIdMask>
+	void buildCondensation(const AdjacencyLists& theAdjacency, const UsedIdMask& theIsIdUsed);
+
+private:
+	std::vector<ComponentId> myComponentIds; //   ( -  )
+	std::vector<size_t> myComponentSizes;    //     ( -  )
+
+	std::vector<size_t> myCondensationOffsets;      //     ( -   + 1)
+	std::vector<ComponentId> myCondensationTargets; //   ;      
+};
+
+//=========================================================
+// Function : StrongComponents
+// Purpose  :      
+//=========================================================
+template <class AdjacencyLists, class UsedIdMask>
+StrongComponents::StrongComponents(const AdjacencyLists& theAdjacency, const UsedIdMask& theIsIdUsed)
+{
+	const size_t anIdBound = theAdjacency.size();
+	const uint32_t NotVisited = 0xFFFFFFFF;
+
+	//   .      :
+	//         ,   .
+	std::vector<uint32_t> anOrders(anIdBound, NotVisited); //    
+	std::vector<uint32_t> aLowLinks(anIdBound, 0);          //   ,    
+	std::vector<NodeId> aComponentStack;                    // ,       
+	std::vector<std::pair<NodeId, size_t>> aCallStack;      // (,   )
+	myComponentIds.assign(anIdBound, NoComponent);
+	myComponentSizes.clear();
+
+	uint32_t aNextOrder = 0;
+	for (NodeId aRootId = 0; aRootId < anIdBound; ++aRootId)
+	{
+		if (!theIsIdUsed[aRootId] || anOrders[aRootId] != NotVisited)
+			continue;
+
+		anOrders[aRootId] = aLowLinks[aRootId] = aNextOrder++;
+		aComponentStack.push_back(aRootId);
+		aCallStack.emplace_back(aRootId, 0);
+
+		while (!aCallStack.empty())
+		{
+			const NodeId aCurrentId = aCallStack.back().first;
+			size_t& aPosition = aCallStack.back().second;
+			if (aPosition < theAdjacency[aCurrentId].size())
+			{
+				const NodeId aNextId = theAdjacency[aCurrentId][aPosition++];
+				if (anOrders[aNextId] == NotVisited)
+				{
+					// " "     
+					anOrders[aNextId] = aLowLinks[aNextId] = aNextOrder++;
+					aComponentStack.push_back(aNextId);
+					aCallStack.emplace_back(aNextId, 0);
+				}
+				else if (myComponentIds[aNextId] == NoComponent)
+				{
+					//     ,       
+					aLowLinks[aCurrentId] = std::min(aLowLinks[aCurrentId], anOrders[aNextId]);
+				}
+				continue;
+			}
+
+			//     - "  "
+			aCallStack.pop_back();
+			if (!aCallStack.empty())
+			{
+				const NodeId aParentId = aCallStack.back().first;
+				aLowLinks[aParentId] = std::min(aLowLinks[aParentId], aLowLinks[aCurrentId]);
+			}
+
+			if (aLowLinks[aCurrentId] == anOrders[aCurrentId])
+			{
+				//  -  :    ,   
+				const ComponentId aComponentId = static_cast<ComponentId>(myComponentSizes.size());
+				size_t aSize = 0;
+				NodeId aMemberId = 0;
+				do
+				{
+					aMemberId = aComponentStack.back();
+					aComponentStack.pop_back();
+					myComponentIds[aMemberId] = aComponentId;
+					++aSize;
+				} while (aMemberId != aCurrentId);
+				myComponentSizes.push_back(aSize);
+			}
+		}
+	}
+
+	//         -  .
+	const ComponentId aLastComponentId = static_cast<ComponentId>(myComponentSizes.size()) - 1;
+	for (ComponentId& aComponentId : myComponentIds)
+	{
+		if (aComponentId != NoComponent)
+		{
+			aComponentId = aLastComponentId - aComponentId;
+		}
+	}
+	std::reverse(myComponentSizes.begin(), myComponentSizes.end());
+
+	buildCondensation(theAdjacency, theIsIdUsed);
+}
+
+//=========================================================
+// Function : ForEachSuccessorComponent
+// Purpose  :  ,      
+//=========================================================
+template <class Function>
+void StrongComponents::ForEachSuccessorComponent(ComponentId theComponentId, Function theFunction) const
+{
+	for (size_t i = myCondensationOffsets[theComponentId]; i < myCondensationOffsets[theComponentId + 1]; ++i)
+	{
+		theFunction(myCondensationTargets[i]);
+	}
+}
+
+//=========================================================
+// Function : buildCondensation
+// Purpose  :   
+//=========================================================
+template <class AdjacencyLists, class UsedIdMask>
+void StrongComponents::buildCondensation(const AdjacencyLists& theAdjacency, const UsedIdMask& theIsIdUsed)
+{
+	//  :        -,
+	//       ,      .
+	const size_t aComponentCount = myComponentSizes.size();
+	std::vector<size_t> anOffsets(aComponentCount + 1, 0);
+	for (NodeId anId = 0; anId < theAdjacency.size(); ++anId)
+	{
+		if (!theIsIdUsed[anId])
+			continue;
+		for (NodeId aNextId : theAdjacency[anId])
+		{
+			if (myComponentIds[aNextId] != myComponentIds[anId])
+			{
+				++anOffsets[myComponentIds[anId] + 1];
+			}
+		}
+	}
+	for (size_t i = 1; i < anOffsets.size(); ++i)
+	{
+		anOffsets[i] += anOffsets[i - 1];
+	}
+
+	std::vector<ComponentId> aTargets(anOffsets.back());
+	std::vector<size_t> aPositions(anOffsets.begin(), anOffsets.end() - 1);
+	for (NodeId anId = 0; anId < theAdjacency.size(); ++anId)
+	{
+		if (!theIsIdUsed[anId])
+			continue;
+		for (NodeId aNextId : theAdjacency[anId])
+		{
+			if (myComponentIds[aNextId] != myComponentIds[anId])
+			{
+				aTargets[aPositions[myComponentIds[anId]]++] = myComponentIds[aNextId];
+			}
+		}
+	}
+
+	myCondensationOffsets.assign(1, 0);
+	myCondensationOffsets.reserve(aComponentCount + 1);
+	myCondensationTargets.clear();
+	myCondensationTargets.reserve(aTargets.size());
+	for (ComponentId aComponentId = 0; aComponentId < aComponentCount; ++aComponentId)
+	{
+		auto aBegin = aTargets.begin() + anOffsets[aComponentId];
+		auto anEnd = aTargets.begin() + anOffsets[aComponentId + 1];
+		std::sort(aBegin, anEnd);
+		myCondensationTargets.insert(myCondensationTargets.end(), aBegin, std::unique(aBegin, anEnd));
+		myCondensationOffsets.push_back(myCondensationTargets.size());
+	}
+}
@@ -0,0 +1,128 @@
+﻿#include "pch.h"
+
+#include "bit_matrix_graph.h"
+#include "gtest.h"
+
+#include <string>
+#include <sstream>
+
+// Рисунки используемых графов приведены в test_graph.cpp.
+
+namespace
+{
+	using IntGraph = Graph<int>;
+	using StringGraph = Graph<std::string>;
+	using StringBitMatrixGraph = BitMatrixGraph<std::string>;
+
+	template<class NodeType>
+	std::string GetInfo(const BitMatrixGraph<NodeType>& theGraph)
+	{
+		std::stringstream aStrOut;
+		aStrOut << theGraph;
+		return aStrOut.str();
+	}
+}
+
+// Тест: Снимок выводится так же, как исходный граф.
+TEST(BitMatrixGraph, snapshot_output_is_the_same_as_graph_output)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	StringBitMatrixGraph aSnapshot(aGraph);
+	ASSERT_EQ(GetInfo(aSnapshot), "a : { b }\nb : { c, d }\nc : { }\nd : { a }\n");
+	ASSERT_EQ(aSnapshot.GetNodeCount(), 4u);
+}
+
+// Тест: "ContainsNode" и "ContainsEdge" снимка совпадают с ответами графа.
+TEST(BitMatrixGraph, contains_node_and_contains_edge_match_graph)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	StringBitMatrixGraph aSnapshot(aGraph);
+	ASSERT_TRUE(aSnapshot.ContainsNode("a") && aSnapshot.ContainsNode("d") && !aSnapshot.ContainsNode("e"));
+	ASSERT_TRUE(aSnapshot.ContainsEdge(std::make_pair("a", "b")) &&
+		aSnapshot.ContainsEdge(std::make_pair("b", "d")) &&
+		aSnapshot.ContainsEdge(std::make_pair("d", "a")));
+	ASSERT_FALSE(aSnapshot.ContainsEdge(std::make_pair("a", "d")) ||
+		aSnapshot.ContainsEdge(std::make_pair("c", "a")) ||
+		aSnapshot.ContainsEdge(std::make_pair("x", "a")));
+}
+
+// Тест: ExistsPathBetweenTwoNodes снимка совпадает с ответами графа для всех пар узлов.
+TEST(BitMatrixGraph, exists_path_between_two_nodes_matches_graph)
+{
+	// Используется граф 4.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e", "f" }, { {"a", "a"}, {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, { "e", "e"} });
+	StringBitMatrixGraph aSnapshot(aGraph);
+	for (const auto& aBegin : aGraph.GetAdjacencyMap())
+	{
+		for (const auto& anEnd : aGraph.GetAdjacencyMap())
+		{
+			ASSERT_EQ(aSnapshot.ExistsPathBetweenTwoNodes(aBegin.first, anEnd.first),
+				aGraph.ExistsPathBetweenTwoNodes(aBegin.first, anEnd.first));
+		}
+	}
+	ASSERT_ANY_THROW(aSnapshot.ExistsPathBetweenTwoNodes("a", "x"));
+}
+
+// Тест: Обход работает для графа, строки матрицы которого занимают несколько слов.
+TEST(BitMatrixGraph, exists_path_between_two_nodes_works_for_multiword_rows)
+{
+	// Цепочка 0 -> 1 -> ... -> 199 и дуга 199 -> 0.
+	const int aNodeCount = 200;
+	IntGraph aGraph;
+	for (int i = 0; i < aNodeCount; ++i)
+	{
+		aGraph.AddNode(i);
+	}
+	for (int i = 0; i + 1 < aNodeCount; ++i)
+	{
+		aGraph.AddEdge({ i, i + 1 });
+	}
+
+	BitMatrixGraph<int> aChain(aGraph);
+	ASSERT_TRUE(aChain.ExistsPathBetweenTwoNodes(0, 199) && aChain.ExistsPathBetweenTwoNodes(63, 64));
+	ASSERT_FALSE(aChain.ExistsPathBetweenTwoNodes(199, 0) || aChain.ExistsPathBetweenTwoNodes(100, 100));
+	ASSERT_FALSE(aChain.IsGraphConnected());
+
+	aGraph.AddEdge({ aNodeCount - 1, 0 });
+	BitMatrixGraph<int> aCycle(aGraph);
+	ASSERT_TRUE(aCycle.ExistsPathBetweenTwoNodes(199, 0) && aCycle.ExistsPathBetweenTwoNodes(100, 100));
+	ASSERT_TRUE(aCycle.IsGraphConnected());
+}
+
+// Тест: IsGraphConnected снимка совпадает с ответами графа.
+TEST(BitMatrixGraph, is_graph_connected_matches_graph)
+{
+	// Используется граф 5.
+	StringGraph aConnectedGraph;
+	aConnectedGraph.Build({ "a", "b", "c", "d", "e", "f" },
+		{ {"a", "b"},{"b", "c"}, {"c", "a"}, {"c", "d"}, {"a", "d"}, {"d", "e"}, {"e", "c"}, {"e", "f"},{"f", "c"} });
+
+	// Используется граф 1.
+	StringGraph aNonConnectedGraph;
+	aNonConnectedGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+
+	// Используется граф 6.
+	StringGraph aSingleNodeGraph;
+	aSingleNodeGraph.AddNode("a");
+
+	ASSERT_TRUE(StringBitMatrixGraph(aConnectedGraph).IsGraphConnected());
+	ASSERT_FALSE(StringBitMatrixGraph(aNonConnectedGraph).IsGraphConnected());
+	ASSERT_TRUE(StringBitMatrixGraph(aSingleNodeGraph).IsGraphConnected());
+	ASSERT_FALSE(StringBitMatrixGraph(StringGraph()).IsGraphConnected());
+}
+
+// Тест: Снимок графа, в котором больше MaxNodeCount узлов, не строится.
+TEST(BitMatrixGraph, throws_when_graph_has_too_many_nodes)
+{
+	IntGraph aGraph;
+	for (size_t i = 0; i <= BitMatrixGraph<int>::MaxNodeCount; ++i)
+	{
+		aGraph.AddNode(static_cast<int>(i));
+	}
+	ASSERT_THROW(BitMatrixGraph<int> aSnapshot(aGraph), std::length_error);
+}
@@ -0,0 +1,131 @@
+﻿#include "pch.h"
+
+#include "csr_graph.h"
+#include "gtest.h"
+
+#include <string>
+#include <sstream>
+
+// Рисунки используемых графов приведены в test_graph.cpp.
+
+namespace
+{
+	using StringGraph = Graph<std::string>;
+	using StringCsrGraph = CsrGraph<std::string>;
+
+	template<class NodeType>
+	std::string GetInfo(const CsrGraph<NodeType>& theGraph)
+	{
+		std::stringstream aStrOut;
+		aStrOut << theGraph;
+		return aStrOut.str();
+	}
+}
+
+// Тест: Может построить снимок пустого графа.
+TEST(CsrGraph, can_create_snapshot_of_empty_graph)
+{
+	StringGraph aGraph;
+	StringCsrGraph aSnapshot(aGraph);
+	ASSERT_EQ(aSnapshot.GetNodeCount(), 0u);
+}
+
+// Тест: Снимок выводится так же, как исходный граф.
+TEST(CsrGraph, snapshot_output_is_the_same_as_graph_output)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	StringCsrGraph aSnapshot(aGraph);
+	ASSERT_EQ(GetInfo(aSnapshot), "a : { b }\nb : { c, d }\nc : { }\nd : { a }\n");
+	ASSERT_EQ(aSnapshot.GetNodeCount(), 4u);
+	ASSERT_EQ(aSnapshot.GetEdgeCount(), 4u);
+}
+
+// Тест: Снимок графа, узлы которого добавлены не по порядку и перебираются индексом в неопределенном порядке,
+// выводит узлы и их соседей по возрастанию.
+TEST(CsrGraph, snapshot_of_graph_with_hash_node_index_is_ordered_by_nodes)
+{
+	// Используется граф 1.
+	Graph<std::string, FlatHashNodeIndex<std::string>> aGraph;
+	aGraph.Build({ "d", "c", "b", "a" }, { {"d", "a"}, {"b", "d"}, {"b", "c"}, {"a", "b"} });
+	StringCsrGraph aSnapshot(aGraph);
+	ASSERT_EQ(GetInfo(aSnapshot), "a : { b }\nb : { c, d }\nc : { }\nd : { a }\n");
+	ASSERT_TRUE(aSnapshot.ExistsPathBetweenTwoNodes("d", "c"));
+}
+
+// Тест: Снимок не меняется при изменении исходного графа.
+TEST(CsrGraph, snapshot_does_not_change_when_graph_changes)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	StringCsrGraph aSnapshot(aGraph);
+	aGraph.RemoveNode("b");
+	ASSERT_TRUE(aSnapshot.ContainsNode("b") && aSnapshot.ContainsEdge(std::make_pair("a", "b")));
+}
+
+// Тест: "ContainsNode" и "ContainsEdge" снимка совпадают с ответами графа.
+TEST(CsrGraph, contains_node_and_contains_edge_match_graph)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	StringCsrGraph aSnapshot(aGraph);
+	ASSERT_TRUE(aSnapshot.ContainsNode("a") && aSnapshot.ContainsNode("d") && !aSnapshot.ContainsNode("e"));
+	ASSERT_TRUE(aSnapshot.ContainsEdge(std::make_pair("a", "b")) &&
+		aSnapshot.ContainsEdge(std::make_pair("b", "d")) &&
+		aSnapshot.ContainsEdge(std::make_pair("d", "a")));
+	ASSERT_FALSE(aSnapshot.ContainsEdge(std::make_pair("a", "d")) ||
+		aSnapshot.ContainsEdge(std::make_pair("c", "a")) ||
+		aSnapshot.ContainsEdge(std::make_pair("x", "a")));
+}
+
+// Тест: ExistsPathBetweenTwoNodes снимка совпадает с ответами графа для всех пар узлов.
+TEST(CsrGraph, exists_path_between_two_nodes_matches_graph)
+{
+	// Используется граф 4.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e", "f" }, { {"a", "a"}, {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, { "e", "e"} });
+	StringCsrGraph aSnapshot(aGraph);
+	for (const auto& aBegin : aGraph.GetAdjacencyMap())
+	{
+		for (const auto& anEnd : aGraph.GetAdjacencyMap())
+		{
+			ASSERT_EQ(aSnapshot.ExistsPathBetweenTwoNodes(aBegin.first, anEnd.first),
+				aGraph.ExistsPathBetweenTwoNodes(aBegin.first, anEnd.first));
+		}
+	}
+}
+
+// Тест: ExistsPathBetweenTwoNodes снимка кидает исключение, если снимок не содержит переданный узел.
+TEST(CsrGraph, exists_path_between_two_nodes_throws_when_snapshot_does_not_contain_node)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	StringCsrGraph aSnapshot(aGraph);
+	ASSERT_ANY_THROW(aSnapshot.ExistsPathBetweenTwoNodes("a", "e"));
+}
+
+// Тест: IsGraphConnected снимка совпадает с ответами графа.
+TEST(CsrGraph, is_graph_connected_matches_graph)
+{
+	// Используется граф 5.
+	StringGraph aConnectedGraph;
+	aConnectedGraph.Build({ "a", "b", "c", "d", "e", "f" },
+		{ {"a", "b"},{"b", "c"}, {"c", "a"}, {"c", "d"}, {"a", "d"}, {"d", "e"}, {"e", "c"}, {"e", "f"},{"f", "c"} });
+
+	// Используется граф 1.
+	StringGraph aNonConnectedGraph;
+	aNonConnectedGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+
+	// Используется граф 6.
+	StringGraph aSingleNodeGraph;
+	aSingleNodeGraph.AddNode("a");
+
+	ASSERT_TRUE(StringCsrGraph(aConnectedGraph).IsGraphConnected());
+	ASSERT_FALSE(StringCsrGraph(aNonConnectedGraph).IsGraphConnected());
+	ASSERT_TRUE(StringCsrGraph(aSingleNodeGraph).IsGraphConnected());
+	ASSERT_FALSE(StringCsrGraph(StringGraph()).IsGraphConnected());
+}
@@ -6,6 +6,13 @@
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <memory_resource>
+#include <set>
+#include <mutex>
+#include <thread>
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#include <span>
+#endif
 
 // Использовалось для рисования графиков - https://asciiflow.com/
 
@@ -131,6 +138,8 @@ namespace
 {
 	using IntGraph = Graph<int>;
 	using StringGraph = Graph<std::string>;
+	using HashStringGraph = Graph<std::string, FlatHashNodeIndex<std::string>>;
+	using WeightedStringGraph = Graph<std::string, OrderedNodeIndex<std::string>, double>;
 
 	template<class NodeType>
 	std::string GetInfo(const Graph<NodeType>& theGraph)
@@ -747,3 +756,1419 @@ TEST(Graph, is_graph_connected_returns_false_for_non_connected_graph)
 	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
 	ASSERT_FALSE(aGraph.IsGraphConnected());
 }
+
+// Тест: Списки смежных узлов упорядочены независимо от порядка добавления узлов и дуг.
+TEST(Graph, adjacency_lists_are_sorted_regardless_of_insertion_order)
+{
+	StringGraph aGraph;
+	aGraph.AddNode("d");
+	aGraph.AddNode("c");
+	aGraph.AddNode("b");
+	aGraph.AddNode("a");
+	aGraph.AddEdge({ "a", "d" });
+	aGraph.AddEdge({ "a", "b" });
+	aGraph.AddEdge({ "a", "c" });
+
+	ASSERT_EQ(GetInfo(aGraph), "a : { b, c, d }\nb : { }\nc : { }\nd : { }\n");
+}
+
+// Тест: Узел, добавленный после удаления другого узла, не наследует его дуги.
+TEST(Graph, node_added_after_removal_does_not_inherit_edges_of_removed_node)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	aGraph.RemoveNode("b");
+	aGraph.AddNode("e");
+	aGraph.AddEdge({ "e", "a" });
+
+	ASSERT_EQ(aGraph.GetAdjacencyMap(), StringGraph::GraphMap(
+		{
+			{"a", {}},
+			{"c", {}},
+			{"d", {"a"}},
+			{"e", {"a"}}
+		}));
+	ASSERT_TRUE(aGraph.ExistsPathBetweenTwoNodes("e", "a") && !aGraph.ExistsPathBetweenTwoNodes("a", "e"));
+}
+
+// Тест: Узел с большим количеством исходящих дуг корректно добавляет, находит и удаляет дуги.
+TEST(Graph, node_with_many_outgoing_edges_adds_finds_and_removes_edges)
+{
+	const int aNodeCount = 1000;
+	IntGraph aGraph;
+	for (int i = 0; i < aNodeCount; ++i)
+	{
+		aGraph.AddNode(i);
+	}
+	// дуги добавляются в порядке, отличном от порядка узлов
+	for (int i = 0; i < aNodeCount; ++i)
+	{
+		ASSERT_TRUE(aGraph.AddEdge({ 0, (i * 7) % aNodeCount }));
+	}
+	ASSERT_FALSE(aGraph.AddEdge({ 0, 500 }));
+
+	for (int i = 1; i < aNodeCount; i += 2)
+	{
+		ASSERT_TRUE(aGraph.RemoveEdge({ 0, i }));
+	}
+	for (int i = 0; i < aNodeCount; ++i)
+	{
+		ASSERT_EQ(aGraph.ContainsEdge({ 0, i }), i % 2 == 0);
+	}
+
+	const IntGraph::NodeList aNodeList = aGraph.GetAdjacencyMap().at(0);
+	ASSERT_EQ(aNodeList.size(), static_cast<size_t>(aNodeCount / 2));
+	ASSERT_TRUE(std::is_sorted(aNodeList.begin(), aNodeList.end()));
+}
+
+// Тест: Граф с хеш-индексом узлов строится так же, как граф с упорядоченным индексом.
+TEST(Graph, graph_with_hash_node_index_is_built_the_same_way)
+{
+	// Используется граф 1.
+	HashStringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	ASSERT_EQ(aGraph.GetAdjacencyMap(), HashStringGraph::GraphMap(
+		{
+			{"a", {"b"}},
+			{"b", {"c", "d"}},
+			{"c", {}},
+			{"d", {"a"}}
+		}));
+	ASSERT_TRUE(aGraph.ContainsEdge(std::make_pair("b", "d")) && !aGraph.ContainsEdge(std::make_pair("d", "b")));
+	ASSERT_TRUE(aGraph.ExistsPathBetweenTwoNodes("a", "c") && !aGraph.ExistsPathBetweenTwoNodes("c", "a"));
+	ASSERT_FALSE(aGraph.IsGraphConnected());
+}
+
+// Тест: Граф с хеш-индексом узлов находит оставшиеся узлы после удаления большого количества узлов.
+TEST(Graph, graph_with_hash_node_index_finds_remaining_nodes_after_removals)
+{
+	const int aNodeCount = 2000;
+	Graph<int, FlatHashNodeIndex<int>> aGraph;
+	for (int i = 0; i < aNodeCount; ++i)
+	{
+		ASSERT_TRUE(aGraph.AddNode(i * 1024)); // узлы с одинаковыми младшими битами
+	}
+	for (int i = 0; i < aNodeCount; i += 3)
+	{
+		ASSERT_TRUE(aGraph.RemoveNode(i * 1024));
+	}
+	for (int i = 0; i < aNodeCount; ++i)
+	{
+		ASSERT_EQ(aGraph.ContainsNode(i * 1024), i % 3 != 0);
+	}
+	ASSERT_FALSE(aGraph.ContainsNode(1));
+}
+
+// Тест: Удаление узла с включенным обратным индексом дает тот же граф, что и без индекса.
+TEST(Graph, removal_of_node_with_reverse_index_gives_the_same_graph)
+{
+	// Используется граф 3.
+	StringGraph aGraph1;
+	aGraph1.Build({ "a", "b", "c", "d", "e" }, { {"a", "a"}, {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, { "e", "e"} });
+
+	StringGraph aGraph2;
+	aGraph2.SetReverseIndexEnabled(true);
+	aGraph2.Build({ "a", "b", "c", "d", "e" }, { {"a", "a"}, {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, { "e", "e"} });
+
+	ASSERT_TRUE(aGraph1.RemoveNode("a") && aGraph2.RemoveNode("a"));
+	ASSERT_TRUE(aGraph1.RemoveNode("e") && aGraph2.RemoveNode("e"));
+	ASSERT_EQ(aGraph1, aGraph2);
+	ASSERT_EQ(aGraph2.GetAdjacencyMap(), StringGraph::GraphMap(
+		{
+			{"b", {"c", "d"}},
+			{"c", {}},
+			{"d", {}}
+		}));
+}
+
+// Тест: Обратный индекс поддерживается при добавлении и удалении дуг и узлов.
+TEST(Graph, reverse_index_is_maintained_by_edge_and_node_changes)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	aGraph.SetReverseIndexEnabled(true);
+	ASSERT_TRUE(aGraph.IsReverseIndexEnabled());
+
+	aGraph.AddNode("e");
+	aGraph.AddEdge({ "e", "c" });
+	aGraph.AddEdge({ "c", "e" });
+	aGraph.RemoveEdge({ "b", "c" });
+	aGraph.RemoveNode("c");
+
+	ASSERT_EQ(aGraph.GetAdjacencyMap(), StringGraph::GraphMap(
+		{
+			{"a", {"b"}},
+			{"b", {"d"}},
+			{"d", {"a"}},
+			{"e", {}}
+		}));
+
+	// идентификатор удаленного узла используется повторно, и у нового узла нет чужих входящих дуг
+	aGraph.AddNode("f");
+	aGraph.RemoveNode("e");
+	ASSERT_EQ(aGraph.GetAdjacencyMap(), StringGraph::GraphMap(
+		{
+			{"a", {"b"}},
+			{"b", {"d"}},
+			{"d", {"a"}},
+			{"f", {}}
+		}));
+}
+
+// Тест: Граф выделяет всю память из переданного ресурса памяти.
+TEST(Graph, graph_allocates_memory_from_given_memory_resource)
+{
+	std::pmr::monotonic_buffer_resource aMemoryResource;
+
+	// Пока ресурс по умолчанию запрещает выделение памяти, любое выделение памяти не из aMemoryResource
+	// приведет к исключению std::bad_alloc.
+	std::pmr::memory_resource* aDefaultResource = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+	bool aPathExists = false;
+	bool anIsConnected = true;
+	try
+	{
+		Graph<int> aGraph(&aMemoryResource);
+		aGraph.SetReverseIndexEnabled(true);
+		aGraph.Build({ 1, 2, 3, 4 }, { {1, 2}, {2, 3}, {2, 4}, {4, 1} });
+		aGraph.AddNode(5);
+		aGraph.AddEdge({ 5, 1 });
+		aGraph.RemoveEdge({ 2, 3 });
+		aGraph.RemoveNode(3);
+		aPathExists = aGraph.ExistsPathBetweenTwoNodes(5, 4);
+		anIsConnected = aGraph.IsGraphConnected();
+	}
+	catch (...)
+	{
+		std::pmr::set_default_resource(aDefaultResource);
+		FAIL() << "Graph allocated memory outside of given memory resource";
+	}
+	std::pmr::set_default_resource(aDefaultResource);
+
+	ASSERT_TRUE(aPathExists);
+	ASSERT_FALSE(anIsConnected);
+}
+
+// Тест: Копия графа, выделяющего память из ресурса памяти, совпадает с исходным графом.
+TEST(Graph, copy_of_graph_with_memory_resource_is_equal_to_source_graph)
+{
+	std::pmr::monotonic_buffer_resource aMemoryResource;
+	StringGraph aGraph(&aMemoryResource);
+	// Используется граф 1.
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+
+	StringGraph aCopy(aGraph);
+	ASSERT_EQ(aGraph.GetMemoryResource(), &aMemoryResource);
+	ASSERT_EQ(aCopy.GetMemoryResource(), std::pmr::get_default_resource());
+	ASSERT_EQ(aCopy, aGraph);
+}
+
+// Тест: Одна рабочая область обхода может использоваться для разных графов и многих обходов.
+TEST(Graph, traversal_workspace_can_be_reused_for_different_graphs)
+{
+	// Используется граф 4.
+	StringGraph aGraph1;
+	aGraph1.Build({ "a", "b", "c", "d", "e", "f" }, { {"a", "a"}, {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, { "e", "e"} });
+
+	// Цепочка 0 -> 1 -> ... -> 99.
+	IntGraph aGraph2;
+	for (int i = 0; i < 100; ++i)
+	{
+		aGraph2.AddNode(i);
+		if (i > 0)
+		{
+			aGraph2.AddEdge({ i - 1, i });
+		}
+	}
+
+	TraversalWorkspace aWorkspace;
+	for (int i = 0; i < 3; ++i)
+	{
+		ASSERT_TRUE(aGraph1.ExistsPathBetweenTwoNodes("d", "c", aWorkspace));
+		ASSERT_FALSE(aGraph1.ExistsPathBetweenTwoNodes("c", "c", aWorkspace));
+		ASSERT_TRUE(aGraph2.ExistsPathBetweenTwoNodes(0, 99, aWorkspace));
+		ASSERT_FALSE(aGraph2.ExistsPathBetweenTwoNodes(99, 0, aWorkspace));
+		ASSERT_FALSE(aGraph1.ExistsPathBetweenTwoNodes("e", "f", aWorkspace));
+	}
+}
+
+// Тест: IsGraphConnected дает одинаковый ответ с обратным индексом и без него.
+TEST(Graph, is_graph_connected_gives_the_same_answer_with_and_without_reverse_index)
+{
+	// Используется граф 5.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e", "f" },
+		{ {"a", "b"},{"b", "c"}, {"c", "a"}, {"c", "d"}, {"a", "d"}, {"d", "e"}, {"e", "c"}, {"e", "f"},{"f", "c"} });
+	ASSERT_TRUE(aGraph.IsGraphConnected());
+	aGraph.SetReverseIndexEnabled(true);
+	ASSERT_TRUE(aGraph.IsGraphConnected());
+
+	// после удаления дуги (f, c) из узла f нельзя никуда попасть
+	aGraph.RemoveEdge({ "f", "c" });
+	ASSERT_FALSE(aGraph.IsGraphConnected());
+	aGraph.SetReverseIndexEnabled(false);
+	ASSERT_FALSE(aGraph.IsGraphConnected());
+}
+
+// Тест: IsGraphConnected работает для графа после удаления узлов.
+TEST(Graph, is_graph_connected_works_after_node_removal)
+{
+	// Используется граф 2: без узла e граф 2 совпадает с графом 1.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	aGraph.RemoveNode("e");
+	aGraph.RemoveNode("c");
+	ASSERT_TRUE(aGraph.IsGraphConnected());
+}
+
+// Тест: IsGraphWeaklyConnected возвращает истину для слабо связного графа.
+TEST(Graph, is_graph_weakly_connected_returns_true_for_weakly_connected_graph)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	ASSERT_TRUE(aGraph.IsGraphWeaklyConnected());
+	aGraph.SetReverseIndexEnabled(true);
+	ASSERT_TRUE(aGraph.IsGraphWeaklyConnected());
+}
+
+// Тест: IsGraphWeaklyConnected возвращает ложь для графа, который не является слабо связным.
+TEST(Graph, is_graph_weakly_connected_returns_false_for_non_weakly_connected_graph)
+{
+	// Используется граф 3.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e" }, { {"a", "a"}, {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, { "e", "e"} });
+	ASSERT_FALSE(aGraph.IsGraphWeaklyConnected());
+	ASSERT_FALSE(StringGraph().IsGraphWeaklyConnected());
+
+	// Используется граф 6.
+	StringGraph aSingleNodeGraph;
+	aSingleNodeGraph.AddNode("a");
+	ASSERT_TRUE(aSingleNodeGraph.IsGraphWeaklyConnected());
+}
+
+// Тест: GetStrongComponents относит к одной компоненте узлы, достижимые друг из друга.
+TEST(Graph, get_strong_components_groups_mutually_reachable_nodes)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	const StrongComponents aComponents = aGraph.GetStrongComponents();
+	ASSERT_EQ(2u, aComponents.GetComponentCount());
+	ASSERT_TRUE(aComponents.AreStronglyConnected(aGraph.GetNodeId("a"), aGraph.GetNodeId("d")));
+	ASSERT_TRUE(aComponents.AreStronglyConnected(aGraph.GetNodeId("b"), aGraph.GetNodeId("d")));
+	ASSERT_FALSE(aComponents.AreStronglyConnected(aGraph.GetNodeId("a"), aGraph.GetNodeId("c")));
+	ASSERT_EQ(3u, aComponents.GetComponentSize(aComponents.GetComponentId(aGraph.GetNodeId("a"))));
+
+	// компоненты пронумерованы в топологическом порядке: из {a, b, d} есть дуга в {c}
+	ASSERT_LT(aComponents.GetComponentId(aGraph.GetNodeId("a")), aComponents.GetComponentId(aGraph.GetNodeId("c")));
+	ASSERT_THROW(aGraph.GetNodeId("e"), std::invalid_argument);
+}
+
+// Тест: GetCondensation возвращает граф компонент сильной связности.
+TEST(Graph, get_condensation_returns_graph_of_strong_components)
+{
+	// Используется граф 3.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e" }, { {"a", "a"}, {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, { "e", "e"} });
+	const StrongComponents aComponents = aGraph.GetStrongComponents();
+	const StrongComponents::ComponentId aCycleId = aComponents.GetComponentId(aGraph.GetNodeId("a"));
+	const StrongComponents::ComponentId aCId = aComponents.GetComponentId(aGraph.GetNodeId("c"));
+	const StrongComponents::ComponentId anEId = aComponents.GetComponentId(aGraph.GetNodeId("e"));
+
+	Graph<StrongComponents::ComponentId> anExpectedGraph;
+	anExpectedGraph.Build({ aCycleId, aCId, anEId }, { {aCycleId, aCId} });
+	ASSERT_EQ(anExpectedGraph, aGraph.GetCondensation());
+	ASSERT_EQ(1u, aComponents.GetCondensationEdgeCount());
+}
+
+// Тест: GetStrongComponents не переполняет стек на длинном цикле.
+TEST(Graph, get_strong_components_handles_deep_graph)
+{
+	const int aNodeCount = 200000;
+	IntGraph aGraph;
+	for (int i = 0; i < aNodeCount; ++i)
+	{
+		aGraph.AddNode(i);
+	}
+	for (int i = 0; i < aNodeCount; ++i)
+	{
+		aGraph.AddEdge({ i, (i + 1) % aNodeCount });
+	}
+	ASSERT_EQ(1u, aGraph.GetStrongComponents().GetComponentCount());
+
+	aGraph.RemoveEdge({ aNodeCount - 1, 0 });
+	ASSERT_EQ(static_cast<size_t>(aNodeCount), aGraph.GetStrongComponents().GetComponentCount());
+}
+
+// Тест: отслеживание компонент слабой связности обновляется при добавлении узлов и дуг.
+TEST(Graph, weak_component_tracking_follows_added_nodes_and_edges)
+{
+	// Используется граф 2.
+	StringGraph aGraph;
+	aGraph.SetWeakComponentTrackingEnabled(true);
+	ASSERT_FALSE(aGraph.IsGraphWeaklyConnected());
+	aGraph.Build({ "a", "b", "c", "d", "e" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	ASSERT_FALSE(aGraph.IsGraphWeaklyConnected());
+	ASSERT_TRUE(aGraph.AreWeaklyConnected("a", "c"));
+	ASSERT_FALSE(aGraph.AreWeaklyConnected("a", "e"));
+
+	// дуга (e, c) соединяет узел e с остальными узлами
+	aGraph.AddEdge({ "e", "c" });
+	ASSERT_TRUE(aGraph.IsGraphWeaklyConnected());
+	ASSERT_TRUE(aGraph.AreWeaklyConnected("a", "e"));
+
+	aGraph.AddNode("f");
+	ASSERT_FALSE(aGraph.IsGraphWeaklyConnected());
+	ASSERT_THROW(aGraph.AreWeaklyConnected("a", "g"), std::invalid_argument);
+}
+
+// Тест: отслеживаемые компоненты слабой связности перестраиваются после удаления узлов и дуг.
+TEST(Graph, weak_component_tracking_is_rebuilt_after_removal)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	aGraph.SetWeakComponentTrackingEnabled(true);
+	ASSERT_TRUE(aGraph.IsGraphWeaklyConnected());
+
+	aGraph.RemoveEdge({ "b", "c" });
+	ASSERT_FALSE(aGraph.IsGraphWeaklyConnected());
+	ASSERT_FALSE(aGraph.AreWeaklyConnected("a", "c"));
+
+	// после удаления узла b узел a связан с d дугой (d, a), а c по-прежнему отделен
+	aGraph.RemoveNode("b");
+	aGraph.AddNode("e");
+	aGraph.AddEdge({ "e", "c" });
+	ASSERT_TRUE(aGraph.AreWeaklyConnected("a", "d"));
+	ASSERT_TRUE(aGraph.AreWeaklyConnected("c", "e"));
+	ASSERT_FALSE(aGraph.AreWeaklyConnected("a", "e"));
+
+	aGraph.SetWeakComponentTrackingEnabled(false);
+	ASSERT_FALSE(aGraph.AreWeaklyConnected("a", "e"));
+}
+
+// Тест: запросы к отслеживаемым компонентам слабой связности из нескольких потоков после удаления дуги
+// дают те же ответы, что и из одного потока.
+TEST(Graph, weak_component_queries_from_several_threads_agree_after_removal)
+{
+	Graph<int> aGraph;
+	std::list<int> aNodes;
+	std::list<Graph<int>::Edge> anEdges;
+	for (int i = 0; i < 1000; ++i)
+	{
+		aNodes.push_back(i);
+		if (i > 0)
+		{
+			anEdges.push_back({ i - 1, i });
+		}
+	}
+	aGraph.Build(aNodes, anEdges);
+	aGraph.SetWeakComponentTrackingEnabled(true);
+	aGraph.RemoveEdge({ 499, 500 }); // компоненты перестраиваются при первом запросе
+
+	std::vector<char> anAnswers(4 * 1000, 0);
+	std::vector<std::thread> aThreads;
+	for (int aThread = 0; aThread < 4; ++aThread)
+	{
+		aThreads.emplace_back([&aGraph, &anAnswers, aThread]
+		{
+			for (int i = 0; i < 1000; ++i)
+			{
+				anAnswers[aThread * 1000 + i] = aGraph.AreWeaklyConnected(0, i);
+			}
+		});
+	}
+	for (std::thread& aThread : aThreads)
+	{
+		aThread.join();
+	}
+
+	for (int aThread = 0; aThread < 4; ++aThread)
+	{
+		for (int i = 0; i < 1000; ++i)
+		{
+			ASSERT_EQ(i < 500, anAnswers[aThread * 1000 + i] != 0);
+		}
+	}
+	ASSERT_FALSE(aGraph.IsGraphWeaklyConnected());
+}
+
+// Тест: ExistsPathBetweenTwoNodes с индексом достижимости отвечает так же, как обход графа.
+TEST(Graph, exists_path_with_reachability_index_matches_traversal)
+{
+	// Используется граф 3.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e" }, { {"a", "a"}, {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, { "e", "e"} });
+	StringGraph anIndexedGraph = aGraph;
+	anIndexedGraph.SetReachabilityIndexEnabled(true);
+
+	const StringGraph::NodeList aNodes = { "a", "b", "c", "d", "e" };
+	for (const auto& aBeginNode : aNodes)
+	{
+		for (const auto& anEndNode : aNodes)
+		{
+			ASSERT_EQ(aGraph.ExistsPathBetweenTwoNodes(aBeginNode, anEndNode),
+			          anIndexedGraph.ExistsPathBetweenTwoNodes(aBeginNode, anEndNode));
+		}
+	}
+	ASSERT_FALSE(anIndexedGraph.ExistsPathBetweenTwoNodes("c", "c"));
+	ASSERT_THROW(anIndexedGraph.ExistsPathBetweenTwoNodes("a", "f"), std::invalid_argument);
+}
+
+// Тест: индекс достижимости перестраивается после изменения графа.
+TEST(Graph, reachability_index_follows_graph_changes)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.SetReachabilityIndexEnabled(true);
+	aGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	ASSERT_TRUE(aGraph.ExistsPathBetweenTwoNodes("d", "c"));
+	ASSERT_FALSE(aGraph.ExistsPathBetweenTwoNodes("c", "a"));
+
+	aGraph.AddNode("e");
+	ASSERT_FALSE(aGraph.ExistsPathBetweenTwoNodes("a", "e"));
+	aGraph.AddEdge({ "c", "e" });
+	ASSERT_TRUE(aGraph.ExistsPathBetweenTwoNodes("a", "e"));
+	aGraph.AddEdge({ "e", "a" });
+	ASSERT_TRUE(aGraph.ExistsPathBetweenTwoNodes("c", "a"));
+
+	aGraph.RemoveNode("b");
+	ASSERT_FALSE(aGraph.ExistsPathBetweenTwoNodes("a", "d"));
+	aGraph.RemoveEdge({ "e", "a" });
+	ASSERT_FALSE(aGraph.ExistsPathBetweenTwoNodes("c", "a"));
+}
+
+// Тест: запросы к устаревшему индексу достижимости из нескольких потоков дают те же ответы, что и из одного потока.
+TEST(Graph, reachability_index_queries_from_several_threads_agree_after_removal)
+{
+	Graph<int> aGraph;
+	std::list<int> aNodes;
+	std::list<Graph<int>::Edge> anEdges;
+	for (int i = 0; i < 1000; ++i)
+	{
+		aNodes.push_back(i);
+		if (i > 0)
+		{
+			anEdges.push_back({ i - 1, i });
+		}
+	}
+	aGraph.Build(aNodes, anEdges);
+	aGraph.SetReachabilityIndexEnabled(true);
+	aGraph.RemoveEdge({ 499, 500 }); // индекс перестраивается при первом запросе
+
+	std::vector<char> anAnswers(4 * 1000, 0);
+	std::vector<std::thread> aThreads;
+	for (int aThread = 0; aThread < 4; ++aThread)
+	{
+		aThreads.emplace_back([&aGraph, &anAnswers, aThread]
+		{
+			for (int i = 0; i < 1000; ++i)
+			{
+				anAnswers[aThread * 1000 + i] = aGraph.ExistsPathBetweenTwoNodes(0, i);
+			}
+		});
+	}
+	for (std::thread& aThread : aThreads)
+	{
+		aThread.join();
+	}
+
+	for (int aThread = 0; aThread < 4; ++aThread)
+	{
+		for (int i = 0; i < 1000; ++i)
+		{
+			ASSERT_EQ(i > 0 && i < 500, anAnswers[aThread * 1000 + i] != 0);
+		}
+	}
+}
+
+// Тест: интервальные метки индекса достижимости дают те же ответы, что и транзитивное замыкание.
+TEST(Graph, reachability_index_labels_match_closure)
+{
+	// слоистый граф: каждый узел слоя соединен с двумя узлами следующего слоя, плюс несколько обратных дуг
+	const uint32_t aLayerSize = 8;
+	const uint32_t aLayerCount = 6;
+	std::vector<std::vector<uint32_t>> anAdjacency(aLayerSize * aLayerCount);
+	for (uint32_t anId = 0; anId + aLayerSize < anAdjacency.size(); ++anId)
+	{
+		const uint32_t aNextLayer = (anId / aLayerSize + 1) * aLayerSize;
+		anAdjacency[anId].push_back(aNextLayer + (anId * 3) % aLayerSize);
+		anAdjacency[anId].push_back(aNextLayer + (anId * 5 + 1) % aLayerSize);
+	}
+	anAdjacency[20].push_back(4);
+	anAdjacency[45].push_back(30);
+	std::vector<char> anIsIdUsed(anAdjacency.size(), 1);
+	anIsIdUsed[33] = 0;
+	anAdjacency[33].clear();
+
+	const ReachabilityIndex aClosureIndex(anAdjacency, anIsIdUsed);
+	const ReachabilityIndex aLabelIndex(anAdjacency, anIsIdUsed, 0);
+	ASSERT_TRUE(aClosureIndex.HasClosure());
+	ASSERT_FALSE(aLabelIndex.HasClosure());
+	for (uint32_t aBeginId = 0; aBeginId < anAdjacency.size(); ++aBeginId)
+	{
+		for (uint32_t anEndId = 0; anEndId < anAdjacency.size(); ++anEndId)
+		{
+			ASSERT_EQ(aClosureIndex.Reaches(aBeginId, anEndId), aLabelIndex.Reaches(aBeginId, anEndId));
+		}
+	}
+}
+
+// Тест: ExistsPaths отвечает на пакет запросов так же, как ExistsPathBetweenTwoNodes.
+TEST(Graph, exists_paths_matches_exists_path_between_two_nodes)
+{
+	// Используется граф 3.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e" }, { {"a", "a"}, {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, { "e", "e"} });
+
+	std::vector<std::pair<std::string, std::string>> aQueries;
+	const StringGraph::NodeList aNodes = { "a", "b", "c", "d", "e" };
+	for (int aRepeat = 0; aRepeat < 3; ++aRepeat)
+	{
+		for (const auto& aBeginNode : aNodes)
+		{
+			for (const auto& anEndNode : aNodes)
+			{
+				aQueries.emplace_back(aBeginNode, anEndNode);
+			}
+		}
+	}
+
+	const std::vector<bool> anAnswers = aGraph.ExistsPaths(aQueries);
+	ASSERT_EQ(aQueries.size(), anAnswers.size());
+	for (size_t i = 0; i < aQueries.size(); ++i)
+	{
+		ASSERT_EQ(aGraph.ExistsPathBetweenTwoNodes(aQueries[i].first, aQueries[i].second), anAnswers[i]);
+	}
+
+	aGraph.SetReachabilityIndexEnabled(true);
+	ASSERT_EQ(anAnswers, aGraph.ExistsPaths(aQueries));
+	ASSERT_TRUE(aGraph.ExistsPaths({}).empty());
+	ASSERT_THROW(aGraph.ExistsPaths({ {"a", "b"}, {"a", "f"} }), std::invalid_argument);
+}
+
+// Тест: ExistsPaths обрабатывает много начальных узлов в нескольких потоках.
+TEST(Graph, exists_paths_handles_many_sources)
+{
+	// цепочка 0 -> 1 -> ... -> 999: путь из i в j существует тогда и только тогда, когда i < j
+	const int aNodeCount = 1000;
+	IntGraph aGraph;
+	for (int i = 0; i < aNodeCount; ++i)
+	{
+		aGraph.AddNode(i);
+	}
+	for (int i = 0; i + 1 < aNodeCount; ++i)
+	{
+		aGraph.AddEdge({ i, i + 1 });
+	}
+
+	std::vector<std::pair<int, int>> aQueries;
+	for (int i = 0; i < aNodeCount; ++i)
+	{
+		aQueries.emplace_back(i, (i * 7) % aNodeCount);
+		aQueries.emplace_back(i, (i * 13) % aNodeCount);
+	}
+	const std::vector<bool> anAnswers = aGraph.ExistsPaths(aQueries);
+	for (size_t i = 0; i < aQueries.size(); ++i)
+	{
+		ASSERT_EQ(aQueries[i].first < aQueries[i].second, anAnswers[i]);
+	}
+}
+
+// Тест: VisitFromSources находит длины кратчайших путей сразу из нескольких узлов.
+TEST(Graph, visit_from_sources_reports_shortest_path_levels)
+{
+	// Используется граф 5.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e", "f" },
+		{ {"a", "b"},{"b", "c"}, {"c", "a"}, {"c", "d"}, {"a", "d"}, {"d", "e"}, {"e", "c"}, {"e", "f"},{"f", "c"} });
+
+	// дорожка 0 - обход из a, дорожка 1 - обход из c
+	std::map<std::string, uint32_t> aLevelsFromA;
+	std::map<std::string, uint32_t> aLevelsFromC;
+	aGraph.VisitFromSources({ aGraph.GetNodeId("a"), aGraph.GetNodeId("c") },
+		[&](StringGraph::NodeId anId, MultiSourceBfs::LaneMask theLanes, uint32_t theLevel)
+	{
+		if (theLanes & 1)
+			aLevelsFromA[aGraph.GetNode(anId)] = theLevel;
+		if (theLanes & 2)
+			aLevelsFromC[aGraph.GetNode(anId)] = theLevel;
+	});
+
+	const std::map<std::string, uint32_t> anExpectedLevelsFromA = { {"a", 3}, {"b", 1}, {"c", 2}, {"d", 1}, {"e", 2}, {"f", 3} };
+	const std::map<std::string, uint32_t> anExpectedLevelsFromC = { {"a", 1}, {"b", 2}, {"c", 3}, {"d", 1}, {"e", 2}, {"f", 3} };
+	ASSERT_EQ(anExpectedLevelsFromA, aLevelsFromA);
+	ASSERT_EQ(anExpectedLevelsFromC, aLevelsFromC);
+
+	ASSERT_THROW(aGraph.VisitFromSources(std::vector<StringGraph::NodeId>(65, 0), [](StringGraph::NodeId, MultiSourceBfs::LaneMask, uint32_t) {}),
+	             std::invalid_argument);
+}
+
+// Тест: GetNodeCount и GetEdgeCount следят за изменениями графа.
+TEST(Graph, get_node_count_and_get_edge_count_follow_graph_changes)
+{
+	// Используется граф 3.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e" }, { {"a", "a"}, {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, { "e", "e"}, {"a", "b"} });
+	ASSERT_EQ(5u, aGraph.GetNodeCount());
+	ASSERT_EQ(6u, aGraph.GetEdgeCount());
+
+	aGraph.AddEdge({ "c", "e" });
+	aGraph.AddEdge({ "c", "e" });
+	ASSERT_EQ(7u, aGraph.GetEdgeCount());
+	aGraph.RemoveEdge({ "b", "d" });
+	ASSERT_EQ(6u, aGraph.GetEdgeCount());
+
+	// удаляются дуги (a, a), (a, b) и (d, a)
+	aGraph.RemoveNode("a");
+	ASSERT_EQ(4u, aGraph.GetNodeCount());
+	ASSERT_EQ(3u, aGraph.GetEdgeCount());
+
+	aGraph.Clear();
+	ASSERT_EQ(0u, aGraph.GetNodeCount());
+	ASSERT_EQ(0u, aGraph.GetEdgeCount());
+}
+
+// Тест: обход с выбором направления находит те же пути, что и обход от фронта.
+TEST(Graph, direction_optimizing_traversal_matches_top_down_traversal)
+{
+	// Граф с малым диаметром: узел 0 ведет во все узлы первой сотни, каждый из них - в 20 узлов остальной части,
+	// поэтому на втором уровне фронт велик и обход переключается на обход снизу вверх.
+	const int aNodeCount = 2000;
+	IntGraph aGraph;
+	for (int i = 0; i < aNodeCount; ++i)
+	{
+		aGraph.AddNode(i);
+	}
+	for (int i = 1; i < 100; ++i)
+	{
+		aGraph.AddEdge({ 0, i });
+		for (int j = 0; j < 20; ++j)
+		{
+			aGraph.AddEdge({ i, 100 + (i * 37 + j * 101) % (aNodeCount - 200) });
+		}
+	}
+	aGraph.AddEdge({ 150, 0 });
+
+	const std::vector<std::pair<int, int>> aQueries = { {0, 0}, {0, 5}, {0, 1500}, {0, 1950}, {5, 0}, {1500, 0}, {150, 150}, {1950, 1950} };
+	for (bool anIsReverseIndexEnabled : { false, true })
+	{
+		aGraph.SetReverseIndexEnabled(anIsReverseIndexEnabled);
+		for (const auto& aQuery : aQueries)
+		{
+			ASSERT_EQ(aGraph.ExistsPathBetweenTwoNodes(aQuery.first, aQuery.second),
+			          aGraph.ExistsPathBetweenTwoNodes(aQuery.first, aQuery.second, TraversalPolicy::DirectionOptimizing));
+		}
+	}
+}
+
+// Тест: параллельный обход дает те же ответы, что и обычный обход.
+TEST(Graph, parallel_traversal_matches_top_down_traversal)
+{
+	// Используется граф 5.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e", "f" },
+		{ {"a", "b"},{"b", "c"}, {"c", "a"}, {"c", "d"}, {"a", "d"}, {"d", "e"}, {"e", "c"}, {"e", "f"},{"f", "c"} });
+	ASSERT_TRUE(aGraph.IsGraphConnected(TraversalPolicy::Parallel));
+	ASSERT_TRUE(aGraph.ExistsPathBetweenTwoNodes("f", "b", TraversalPolicy::Parallel));
+
+	aGraph.RemoveEdge({ "f", "c" });
+	aGraph.AddNode("g");
+	aGraph.AddEdge({ "g", "g" });
+	for (bool anIsReverseIndexEnabled : { false, true })
+	{
+		aGraph.SetReverseIndexEnabled(anIsReverseIndexEnabled);
+		ASSERT_FALSE(aGraph.IsGraphConnected(TraversalPolicy::Parallel));
+		for (const char* aBeginNode : { "a", "c", "f", "g" })
+		{
+			for (const char* anEndNode : { "a", "b", "f", "g" })
+			{
+				ASSERT_EQ(aGraph.ExistsPathBetweenTwoNodes(aBeginNode, anEndNode),
+				          aGraph.ExistsPathBetweenTwoNodes(aBeginNode, anEndNode, TraversalPolicy::Parallel));
+			}
+		}
+	}
+}
+
+// Тест: ParallelBfs в нескольких потоках помечает все достижимые узлы.
+TEST(Graph, parallel_bfs_visits_all_reachable_nodes_with_several_threads)
+{
+	// двоичное дерево из 10000 узлов: из узла i дуги ведут в 2i + 1 и 2i + 2, плюс изолированный узел 10000
+	const uint32_t aNodeCount = 10000;
+	std::vector<std::vector<uint32_t>> anAdjacency(aNodeCount + 1);
+	for (uint32_t i = 0; 2 * i + 2 < aNodeCount; ++i)
+	{
+		anAdjacency[i] = { 2 * i + 1, 2 * i + 2 };
+	}
+	auto aForEachNeighbor = [&anAdjacency](uint32_t anId, auto&& theFunction)
+	{
+		for (uint32_t aNeighborId : anAdjacency[anId])
+		{
+			theFunction(aNeighborId);
+		}
+	};
+
+	ParallelBfs aBfs(4);
+	ASSERT_EQ(aNodeCount - 1, aBfs.Run(0, anAdjacency.size(), aForEachNeighbor, true));
+	ASSERT_TRUE(aBfs.IsVisited(aNodeCount - 2));
+	ASSERT_FALSE(aBfs.IsVisited(aNodeCount));
+
+	// начальный узел не помечается: в него не ведет ни одна дуга
+	aBfs.Run(1, anAdjacency.size(), aForEachNeighbor, false, 9);
+	ASSERT_FALSE(aBfs.IsVisited(1));
+	ASSERT_TRUE(aBfs.IsVisited(9));
+	ASSERT_FALSE(aBfs.IsVisited(2));
+}
+
+// Тест: пул потоков выполняет части запуска одновременно и использует одни и те же рабочие потоки повторно.
+TEST(Graph, thread_pool_reuses_workers_across_runs)
+{
+	ThreadPool aPool;
+	std::mutex aMutex;
+	std::set<std::thread::id> aThreadIds;
+	for (int aRun = 0; aRun < 3; ++aRun)
+	{
+		ThreadBarrier aBarrier(4); // части ждут друг друга, поэтому запуск завершается, только если они выполнялись одновременно
+		size_t anIndexSum = 0;
+		auto aWork = [&](size_t theIndex)
+		{
+			aBarrier.Wait();
+			std::lock_guard<std::mutex> aLock(aMutex);
+			aThreadIds.insert(std::this_thread::get_id());
+			anIndexSum += theIndex;
+		};
+		aPool.Run(4, aWork);
+		ASSERT_EQ(6u, anIndexSum);
+	}
+	ASSERT_EQ(4u, aThreadIds.size()); // вызывающий поток и три рабочих потока, созданных при первом запуске
+}
+
+// Тест: исключение части запуска пула, синхронизированного барьером, передается вызывающему,
+// а остальные части не остаются ждать на барьере.
+TEST(Graph, thread_pool_rethrows_exception_of_part_waiting_at_barrier)
+{
+	ThreadPool aPool;
+	for (size_t aFailingIndex = 0; aFailingIndex < 4; ++aFailingIndex)
+	{
+		ThreadBarrier aBarrier(4);
+		auto aWork = [&aBarrier, aFailingIndex](size_t theIndex)
+		{
+			aBarrier.Wait();
+			if (theIndex == aFailingIndex)
+			{
+				throw std::runtime_error("part failed");
+			}
+			aBarrier.Wait();
+		};
+		ASSERT_THROW(aPool.Run(4, aWork, &aBarrier), std::runtime_error);
+	}
+
+	// пул остается работоспособным
+	std::atomic<size_t> anIndexSum(0);
+	auto aWork = [&anIndexSum](size_t theIndex) { anIndexSum += theIndex; };
+	aPool.Run(4, aWork);
+	ASSERT_EQ(6u, anIndexSum.load());
+}
+
+// Тест: задание с независимыми частями не ждет занятый пул, а выполняется в вызывающем потоке.
+TEST(Graph, thread_pool_runs_independent_work_inline_while_busy)
+{
+	ThreadPool aPool;
+	std::atomic<size_t> aStartedCount(0);
+	std::atomic<bool> anIsReleased(false);
+	auto aBusyWork = [&aStartedCount, &anIsReleased](size_t)
+	{
+		++aStartedCount;
+		while (!anIsReleased)
+		{
+			std::this_thread::yield();
+		}
+	};
+	std::thread aBusyThread([&aPool, &aBusyWork] { aPool.Run(2, aBusyWork); });
+	while (aStartedCount < 2)
+	{
+		std::this_thread::yield();
+	}
+
+	std::set<std::thread::id> aThreadIds;
+	size_t anIndexSum = 0;
+	auto aWork = [&aThreadIds, &anIndexSum](size_t theIndex)
+	{
+		aThreadIds.insert(std::this_thread::get_id());
+		anIndexSum += theIndex;
+	};
+	aPool.RunIndependent(4, aWork);
+	anIsReleased = true;
+	aBusyThread.join();
+
+	ASSERT_EQ(6u, anIndexSum);
+	ASSERT_EQ(std::set<std::thread::id>{ std::this_thread::get_id() }, aThreadIds);
+}
+
+// Тест: ShortestPath и ShortestPathBidirectional возвращают кратчайший путь.
+TEST(Graph, shortest_path_returns_shortest_node_sequence)
+{
+	// Используется граф 5.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e", "f" },
+		{ {"a", "b"},{"b", "c"}, {"c", "a"}, {"c", "d"}, {"a", "d"}, {"d", "e"}, {"e", "c"}, {"e", "f"},{"f", "c"} });
+
+	for (bool anIsReverseIndexEnabled : { false, true })
+	{
+		aGraph.SetReverseIndexEnabled(anIsReverseIndexEnabled);
+		ASSERT_EQ(StringGraph::NodeList({ "a", "d", "e", "f" }), aGraph.ShortestPath("a", "f"));
+		ASSERT_EQ(StringGraph::NodeList({ "a", "d", "e", "f" }), aGraph.ShortestPathBidirectional("a", "f"));
+		ASSERT_EQ(StringGraph::NodeList({ "f", "c", "a", "b" }), aGraph.ShortestPath("f", "b"));
+		ASSERT_EQ(StringGraph::NodeList({ "f", "c", "a", "b" }), aGraph.ShortestPathBidirectional("f", "b"));
+
+		// кратчайших циклов через c два: c -> a -> b -> c и c -> d -> e -> c
+		const StringGraph::NodeList aCycle = aGraph.ShortestPathBidirectional("c", "c");
+		ASSERT_EQ(4u, aCycle.size());
+		ASSERT_EQ("c", aCycle.front());
+		ASSERT_EQ("c", aCycle.back());
+	}
+}
+
+// Тест: ShortestPath возвращает пустой список, если пути нет, и петлю для узла с петлей.
+TEST(Graph, shortest_path_handles_missing_paths_and_loops)
+{
+	// Используется граф 3.
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e" }, { {"a", "a"}, {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, { "e", "e"} });
+	ASSERT_EQ(StringGraph::NodeList({ "a", "a" }), aGraph.ShortestPath("a", "a"));
+	ASSERT_EQ(StringGraph::NodeList({ "e", "e" }), aGraph.ShortestPathBidirectional("e", "e"));
+	ASSERT_TRUE(aGraph.ShortestPath("c", "a").empty());
+	ASSERT_TRUE(aGraph.ShortestPathBidirectional("a", "e").empty());
+	ASSERT_TRUE(aGraph.ShortestPath("c", "c").empty());
+	ASSERT_EQ(StringGraph::NodeList({ "d", "a", "b", "c" }), aGraph.ShortestPathBidirectional("d", "c"));
+	ASSERT_THROW(aGraph.ShortestPath("a", "f"), std::invalid_argument);
+}
+
+// Тест: Distances возвращает расстояния до всех узлов графа.
+TEST(Graph, distances_returns_hop_distances_indexed_by_node_id)
+{
+	// Используется граф 3 (с дополнительным узлом f, в который нет дуг).
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e", "f" }, { {"a", "a"}, {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, { "e", "e"} });
+	aGraph.RemoveNode("f");
+
+	const std::vector<StringGraph::Distance> aDistances = aGraph.Distances("d");
+	ASSERT_EQ(aGraph.GetNodeIdBound(), aDistances.size());
+	ASSERT_EQ(0u, aDistances[aGraph.GetNodeId("d")]);
+	ASSERT_EQ(1u, aDistances[aGraph.GetNodeId("a")]);
+	ASSERT_EQ(2u, aDistances[aGraph.GetNodeId("b")]);
+	ASSERT_EQ(3u, aDistances[aGraph.GetNodeId("c")]);
+	ASSERT_EQ(StringGraph::InfiniteDistance, aDistances[aGraph.GetNodeId("e")]);
+
+	// идентификатор удаленного узла f не назначен ни одному узлу
+	for (StringGraph::NodeId anId = 0; anId < aDistances.size(); ++anId)
+	{
+		if (!aGraph.IsNodeIdUsed(anId))
+		{
+			ASSERT_EQ(StringGraph::InfiniteDistance, aDistances[anId]);
+		}
+	}
+	ASSERT_THROW(aGraph.Distances("f"), std::invalid_argument);
+}
+
+// Тест: веса дуг взвешенного графа задаются при построении и добавлении дуги и сравниваются при сравнении графов.
+TEST(Graph, weighted_graph_stores_edge_weights)
+{
+	WeightedStringGraph aGraph;
+	aGraph.Build({ "a", "b", "c" }, WeightedStringGraph::WeightedEdgeList{ {{"a", "b"}, 1.0}, {{"b", "c"}, 2.0}, {{"a", "b"}, 3.0} });
+	ASSERT_EQ(2u, aGraph.GetEdgeCount());
+	ASSERT_EQ(3.0, aGraph.GetEdgeWeight({ "a", "b" })); // для повторяющихся дуг берется вес последней
+
+	ASSERT_TRUE(aGraph.AddEdge({ "c", "a" }, 4.0));
+	ASSERT_FALSE(aGraph.AddEdge({ "c", "a" }, 5.0)); // вес существующей дуги меняется
+	ASSERT_EQ(5.0, aGraph.GetEdgeWeight({ "c", "a" }));
+	ASSERT_FALSE(aGraph.AddEdge({ "c", "a" })); // добавление без веса вес не меняет
+	ASSERT_EQ(5.0, aGraph.GetEdgeWeight({ "c", "a" }));
+
+	WeightedStringGraph aCopy(aGraph);
+	ASSERT_TRUE(aCopy == aGraph);
+	aCopy.AddEdge({ "b", "c" }, 7.0);
+	ASSERT_TRUE(aCopy != aGraph);
+
+	aGraph.RemoveEdge({ "a", "b" });
+	ASSERT_THROW(aGraph.GetEdgeWeight({ "a", "b" }), std::invalid_argument);
+	ASSERT_EQ(2.0, aGraph.GetEdgeWeight({ "b", "c" }));
+	ASSERT_THROW(aGraph.AddEdge({ "a", "b" }, -1.0), WeightedStringGraph::IncorrectGraphException);
+}
+
+// Тест: WeightedDistances возвращает наименьшие суммы весов путей, а не наименьшее число дуг.
+TEST(Graph, weighted_distances_returns_smallest_weight_sums)
+{
+	// Используется граф 5 с весами.
+	WeightedStringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e", "f" }, WeightedStringGraph::WeightedEdgeList{
+		{{"a", "b"}, 1.0}, {{"b", "c"}, 1.0}, {{"c", "a"}, 1.0}, {{"c", "d"}, 1.0}, {{"a", "d"}, 5.0},
+		{{"d", "e"}, 2.0}, {{"e", "c"}, 1.0}, {{"e", "f"}, 6.0}, {{"f", "c"}, 1.0} });
+
+	const std::vector<double> aDistances = aGraph.WeightedDistances("a", TraversalPolicy::TopDown);
+	ASSERT_EQ(aGraph.GetNodeIdBound(), aDistances.size());
+	ASSERT_EQ(0.0, aDistances[aGraph.GetNodeId("a")]);
+	ASSERT_EQ(2.0, aDistances[aGraph.GetNodeId("c")]);
+	ASSERT_EQ(3.0, aDistances[aGraph.GetNodeId("d")]); // a -> b -> c -> d короче дуги a -> d
+	ASSERT_EQ(11.0, aDistances[aGraph.GetNodeId("f")]);
+}
+
+// Тест: WeightedDistances с параллельным поиском возвращает те же суммы весов, что и последовательный.
+TEST(Graph, weighted_distances_with_parallel_policy_returns_smallest_weight_sums)
+{
+	// Используется граф 5 с весами.
+	WeightedStringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e", "f" }, WeightedStringGraph::WeightedEdgeList{
+		{{"a", "b"}, 1.0}, {{"b", "c"}, 1.0}, {{"c", "a"}, 1.0}, {{"c", "d"}, 1.0}, {{"a", "d"}, 5.0},
+		{{"d", "e"}, 2.0}, {{"e", "c"}, 1.0}, {{"e", "f"}, 6.0}, {{"f", "c"}, 1.0} });
+
+	const std::vector<double> aDistances = aGraph.WeightedDistances("a", TraversalPolicy::Parallel);
+	ASSERT_EQ(aGraph.GetNodeIdBound(), aDistances.size());
+	ASSERT_EQ(0.0, aDistances[aGraph.GetNodeId("a")]);
+	ASSERT_EQ(2.0, aDistances[aGraph.GetNodeId("c")]);
+	ASSERT_EQ(3.0, aDistances[aGraph.GetNodeId("d")]); // a -> b -> c -> d короче дуги a -> d
+	ASSERT_EQ(11.0, aDistances[aGraph.GetNodeId("f")]);
+}
+
+// Тест: WeightedShortestPath возвращает путь с наименьшей суммой весов.
+TEST(Graph, weighted_shortest_path_returns_path_with_smallest_weight_sum)
+{
+	// Используется граф 5 с весами.
+	WeightedStringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e", "f" }, WeightedStringGraph::WeightedEdgeList{
+		{{"a", "b"}, 1.0}, {{"b", "c"}, 1.0}, {{"c", "a"}, 1.0}, {{"c", "d"}, 1.0}, {{"a", "d"}, 5.0},
+		{{"d", "e"}, 2.0}, {{"e", "c"}, 1.0}, {{"e", "f"}, 6.0}, {{"f", "c"}, 1.0} });
+
+	ASSERT_EQ(WeightedStringGraph::NodeList({ "a", "b", "c", "d", "e" }), aGraph.WeightedShortestPath("a", "e"));
+}
+
+// Тест: WeightedShortestPath из узла в него же возвращает кратчайший цикл.
+TEST(Graph, weighted_shortest_path_returns_shortest_cycle_for_the_same_node)
+{
+	// Используется граф 5 с весами.
+	WeightedStringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e", "f" }, WeightedStringGraph::WeightedEdgeList{
+		{{"a", "b"}, 1.0}, {{"b", "c"}, 1.0}, {{"c", "a"}, 1.0}, {{"c", "d"}, 1.0}, {{"a", "d"}, 5.0},
+		{{"d", "e"}, 2.0}, {{"e", "c"}, 1.0}, {{"e", "f"}, 6.0}, {{"f", "c"}, 1.0} });
+
+	ASSERT_EQ(WeightedStringGraph::NodeList({ "c", "a", "b", "c" }), aGraph.WeightedShortestPath("c", "c"));
+}
+
+// Тест: для недостижимого узла WeightedShortestPath возвращает пустой путь, а WeightedDistances - бесконечный вес.
+TEST(Graph, weighted_shortest_path_returns_empty_list_for_unreachable_node)
+{
+	// Используется граф 5 с весами.
+	WeightedStringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e", "f" }, WeightedStringGraph::WeightedEdgeList{
+		{{"a", "b"}, 1.0}, {{"b", "c"}, 1.0}, {{"c", "a"}, 1.0}, {{"c", "d"}, 1.0}, {{"a", "d"}, 5.0},
+		{{"d", "e"}, 2.0}, {{"e", "c"}, 1.0}, {{"e", "f"}, 6.0}, {{"f", "c"}, 1.0} });
+	aGraph.AddNode("g");
+
+	ASSERT_TRUE(aGraph.WeightedShortestPath("a", "g").empty());
+	ASSERT_EQ(WeightedStringGraph::GetInfiniteWeight(), aGraph.WeightedDistances("a")[aGraph.GetNodeId("g")]);
+}
+
+// Тест: TopologicalOrder упорядочивает узлы графа без циклов так, что каждая дуга идет вперед по порядку.
+TEST(Graph, topological_order_of_acyclic_graph)
+{
+	StringGraph aGraph;
+	aGraph.Build({ "compile", "link", "test", "package", "docs" },
+		{ {"compile", "link"}, {"link", "test"}, {"link", "package"}, {"test", "package"}, {"docs", "package"} });
+	ASSERT_FALSE(aGraph.HasCycle());
+
+	StringGraph::NodeList anOrder;
+	StringGraph::NodeList aCycle;
+	ASSERT_TRUE(aGraph.TopologicalOrder(anOrder, aCycle));
+	ASSERT_TRUE(aCycle.empty());
+	ASSERT_EQ(aGraph.GetNodeCount(), anOrder.size());
+
+	std::map<std::string, size_t> aPositions;
+	for (const std::string& aNode : anOrder)
+	{
+		aPositions[aNode] = aPositions.size();
+	}
+	for (const auto& aNodeAndNeighbors : aGraph.GetAdjacencyMap())
+	{
+		for (const std::string& aNeighbor : aNodeAndNeighbors.second)
+		{
+			ASSERT_LT(aPositions[aNodeAndNeighbors.first], aPositions[aNeighbor]);
+		}
+	}
+}
+
+// Тест: для графа с циклом TopologicalOrder возвращает false и цикл.
+// Используется граф 1 с дополнительным узлом e (дуга c -> e).
+TEST(Graph, topological_order_reports_cycle)
+{
+	StringGraph aGraph;
+	aGraph.Build({ "a", "b", "c", "d", "e" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"}, {"c", "e"} });
+	ASSERT_TRUE(aGraph.HasCycle());
+
+	StringGraph::NodeList anOrder;
+	StringGraph::NodeList aCycle;
+	ASSERT_FALSE(aGraph.TopologicalOrder(anOrder, aCycle));
+	ASSERT_EQ(4u, aCycle.size());
+	ASSERT_EQ(aCycle.front(), aCycle.back());
+	for (auto anIter = aCycle.begin(); std::next(anIter) != aCycle.end(); ++anIter)
+	{
+		ASSERT_TRUE(aGraph.ContainsEdge({ *anIter, *std::next(anIter) }));
+	}
+
+	// после удаления дуги цикла граф ацикличен; петля - тоже цикл
+	aGraph.RemoveEdge({ "d", "a" });
+	ASSERT_FALSE(aGraph.HasCycle());
+	ASSERT_TRUE(aGraph.TopologicalOrder(anOrder));
+	aGraph.AddEdge({ "e", "e" });
+	ASSERT_TRUE(aGraph.HasCycle());
+	ASSERT_FALSE(aGraph.TopologicalOrder(anOrder, aCycle));
+	ASSERT_EQ(StringGraph::NodeList({ "e", "e" }), aCycle);
+}
+
+// Тест: отслеживаемый топологический порядок остается верным после каждого добавления дуги,
+// а дуга, замыкающая цикл, отвергается.
+TEST(Graph, tracked_topological_order_under_edge_insertion)
+{
+	for (bool anIsReverseIndexEnabled : { false, true })
+	{
+		StringGraph aGraph;
+		aGraph.SetReverseIndexEnabled(anIsReverseIndexEnabled);
+		aGraph.Build({ "e", "d", "c", "b", "a" }, {});
+		aGraph.SetTopologicalOrderTrackingEnabled(true);
+
+		// каждая дуга идет против текущего порядка, поэтому порядок перестраивается
+		const StringGraph::EdgeList anEdges = { {"a", "b"}, {"b", "c"}, {"a", "d"}, {"d", "e"}, {"c", "e"} };
+		for (const StringGraph::Edge& anEdge : anEdges)
+		{
+			ASSERT_TRUE(aGraph.AddEdge(anEdge));
+
+			StringGraph::NodeList anOrder;
+			ASSERT_TRUE(aGraph.TopologicalOrder(anOrder));
+			ASSERT_EQ(5u, anOrder.size());
+			std::map<std::string, size_t> aPositions;
+			for (const std::string& aNode : anOrder)
+			{
+				aPositions[aNode] = aPositions.size();
+			}
+			for (const auto& aNodeAndNeighbors : aGraph.GetAdjacencyMap())
+			{
+				for (const std::string& aNeighbor : aNodeAndNeighbors.second)
+				{
+					ASSERT_LT(aPositions[aNodeAndNeighbors.first], aPositions[aNeighbor]);
+				}
+			}
+		}
+
+		ASSERT_THROW(aGraph.AddEdge({ "e", "a" }), StringGraph::IncorrectGraphException);
+		ASSERT_THROW(aGraph.AddEdge({ "c", "c" }), StringGraph::IncorrectGraphException);
+		ASSERT_FALSE(aGraph.ContainsEdge({ "e", "a" }));
+		ASSERT_EQ(anEdges.size(), aGraph.GetEdgeCount());
+	}
+
+	// граф с циклом: отслеживание не включается
+	StringGraph aCyclicGraph;
+	aCyclicGraph.Build({ "a", "b" }, { {"a", "b"}, {"b", "a"} });
+	ASSERT_THROW(aCyclicGraph.SetTopologicalOrderTrackingEnabled(true), StringGraph::IncorrectGraphException);
+	ASSERT_FALSE(aCyclicGraph.IsTopologicalOrderTrackingEnabled());
+}
+
+// Тест: AddNodes возвращает количество узлов, которых не было в графе (повторы считаются один раз).
+TEST(Graph, add_nodes_returns_number_of_new_nodes)
+{
+	StringGraph aGraph;
+	ASSERT_EQ(4u, aGraph.AddNodes(std::vector<std::string>{ "a", "b", "c", "d", "a" }));
+	ASSERT_EQ(0u, aGraph.AddNodes(std::vector<std::string>{ "b" }));
+	ASSERT_EQ(4u, aGraph.GetNodeCount());
+}
+
+// Тест: AddEdges возвращает количество дуг, которых не было в графе (повторы считаются один раз).
+TEST(Graph, add_edges_returns_number_of_new_edges)
+{
+	StringGraph aGraph;
+	aGraph.AddNodes(std::vector<std::string>{ "a", "b", "c", "d" });
+	ASSERT_EQ(2u, aGraph.AddEdges(std::vector<StringGraph::Edge>{ {"b", "d"}, {"a", "b"}, {"a", "b"} }));
+	ASSERT_EQ(2u, aGraph.AddEdges(std::vector<StringGraph::Edge>{ {"d", "a"}, {"b", "c"}, {"b", "d"} }));
+	ASSERT_EQ(4u, aGraph.GetEdgeCount());
+}
+
+// Тест: граф, заполненный пакетами узлов и дуг, совпадает с графом, построенным по спискам.
+TEST(Graph, graph_filled_by_batches_is_the_same_as_built_graph)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.AddNodes(std::vector<std::string>{ "d", "c", "b", "a" });
+	aGraph.AddEdges(std::vector<StringGraph::Edge>{ {"b", "d"}, {"a", "b"}, {"d", "a"}, {"b", "c"} });
+
+	StringGraph anExpectedGraph;
+	anExpectedGraph.Build({ "a", "b", "c", "d" }, { {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+	ASSERT_EQ(anExpectedGraph, aGraph);
+	ASSERT_EQ(anExpectedGraph.IsGraphConnected(), aGraph.IsGraphConnected());
+}
+
+// Тест: пакет дуг, в котором есть дуга с отсутствующим узлом, отвергается целиком.
+TEST(Graph, add_edges_does_not_change_graph_when_edge_has_missing_node)
+{
+	StringGraph aGraph;
+	aGraph.AddNodes(std::vector<std::string>{ "a", "c" });
+	ASSERT_THROW(aGraph.AddEdges(std::vector<StringGraph::Edge>{ {"c", "a"}, {"c", "x"} }), StringGraph::IncorrectGraphException);
+	ASSERT_FALSE(aGraph.ContainsEdge({ "c", "a" }));
+	ASSERT_EQ(0u, aGraph.GetEdgeCount());
+}
+
+// Тест: AddEdges обновляет обратный индекс, которым пользуется удаление узла.
+TEST(Graph, add_edges_updates_reverse_index)
+{
+	// Используется граф 1.
+	StringGraph aGraph;
+	aGraph.SetReverseIndexEnabled(true);
+	aGraph.AddNodes(std::vector<std::string>{ "a", "b", "c", "d" });
+	aGraph.AddEdges(std::vector<StringGraph::Edge>{ {"a", "b"}, {"b", "c"}, {"b", "d"}, {"d", "a"} });
+
+	aGraph.RemoveNode("b");
+	ASSERT_EQ(1u, aGraph.GetEdgeCount());
+	ASSERT_TRUE(aGraph.ContainsEdge({ "d", "a" }));
+}
+
+// Тест: AddEdges с дугами с весами меняет веса существующих дуг (для повторов берется вес последней дуги).
+TEST(Graph, add_edges_with_weights_replaces_weights_of_existing_edges)
+{
+	WeightedStringGraph aGraph;
+	aGraph.Build({ "a", "b", "c" }, WeightedStringGraph::WeightedEdgeList{ {{"a", "b"}, 1.0} });
+	ASSERT_EQ(1u, aGraph.AddEdges(std::vector<WeightedStringGraph::WeightedEdge>{ {{"a", "b"}, 2.0}, {{"b", "c"}, 3.0}, {{"b", "c"}, 4.0} }));
+	ASSERT_EQ(2.0, aGraph.GetEdgeWeight({ "a", "b" }));
+	ASSERT_EQ(4.0, aGraph.GetEdgeWeight({ "b", "c" }));
+}
+
+// Тест: AddEdges с дугами без весов не меняет веса существующих дуг.
+TEST(Graph, add_edges_without_weights_keeps_weights_of_existing_edges)
+{
+	WeightedStringGraph aGraph;
+	aGraph.Build({ "a", "b", "c" }, WeightedStringGraph::WeightedEdgeList{ {{"a", "b"}, 1.0} });
+	ASSERT_EQ(1u, aGraph.AddEdges(std::vector<WeightedStringGraph::Edge>{ {"a", "b"}, {"b", "c"} }));
+	ASSERT_EQ(1.0, aGraph.GetEdgeWeight({ "a", "b" }));
+	ASSERT_EQ(0.0, aGraph.GetEdgeWeight({ "b", "c" }));
+}
+
+// Тест: RemoveNodes удаляет множество узлов вместе с их дугами.
+// Используется граф 5.
+TEST(Graph, remove_nodes_removes_set_of_nodes)
+{
+	for (bool anIsReverseIndexEnabled : { false, true })
+	{
+		StringGraph aGraph;
+		aGraph.SetReverseIndexEnabled(anIsReverseIndexEnabled);
+		aGraph.Build({ "a", "b", "c", "d", "e", "f" },
+			{ {"a", "b"}, {"b", "c"}, {"c", "a"}, {"c", "d"}, {"a", "d"}, {"d", "e"}, {"e", "c"}, {"e", "f"}, {"f", "c"} });
+
+		ASSERT_EQ(2u, aGraph.RemoveNodes(std::vector<std::string>{ "c", "e", "x", "c" }));
+		ASSERT_EQ(4u, aGraph.GetNodeCount());
+		ASSERT_EQ(2u, aGraph.GetEdgeCount());
+
+		StringGraph anExpectedGraph;
+		anExpectedGraph.Build({ "a", "b", "d", "f" }, { {"a", "b"}, {"a", "d"} });
+		ASSERT_TRUE(aGraph == anExpectedGraph);
+
+		// идентификаторы удаленных узлов используются повторно
+		aGraph.AddNode("g");
+		aGraph.AddEdge({ "g", "a" });
+		ASSERT_TRUE(aGraph.ExistsPathBetweenTwoNodes("g", "d"));
+		ASSERT_FALSE(aGraph.ExistsPathBetweenTwoNodes("d", "g"));
+	}
+}
+
+// Однопроходный диапазон целых чисел, читаемых из потока.
+struct IntStreamRange
+{
+	std::istream& myStream;
+
+	std::istream_iterator<int> begin() const { return std::istream_iterator<int>(myStream); }
+	std::istream_iterator<int> end() const { return std::istream_iterator<int>(); }
+};
+
+// Представление чужого массива строк (как std::span): константность представления не запрещает менять строки.
+struct StringSpan
+{
+	std::string* myBegin;
+	std::string* myEnd;
+
+	std::string* begin() const { return myBegin; }
+	std::string* end() const { return myEnd; }
+};
+
+// Тест: может построить граф по векторам-rvalue узлов и дуг с повторами (узлы перемещаются в граф).
+TEST(Graph, can_build_graph_from_rvalue_vectors_with_repeats)
+{
+	std::vector<std::string> aNodes{ "a", "b", "c", "a" };
+	StringGraph aGraph;
+	aGraph.Build(std::move(aNodes), std::vector<StringGraph::Edge>{ {"a", "b"}, {"b", "c"}, {"a", "b"} });
+	ASSERT_EQ(3u, aGraph.GetNodeCount());
+	ASSERT_EQ(2u, aGraph.GetEdgeCount());
+
+	StringGraph anExpectedGraph;
+	anExpectedGraph.Build({ "a", "b", "c" }, { {"a", "b"}, {"b", "c"} });
+	ASSERT_TRUE(aGraph == anExpectedGraph);
+}
+
+// Тест: построение графа по константным контейнерам копирует узлы и не меняет контейнеры.
+TEST(Graph, build_from_const_containers_does_not_change_containers)
+{
+	const std::vector<std::string> aNodes{ "a", "b", "c" };
+	const std::vector<StringGraph::Edge> anEdges{ {"a", "b"}, {"b", "c"} };
+	StringGraph aGraph;
+	aGraph.Build(aNodes, anEdges);
+	ASSERT_EQ(std::vector<std::string>({ "a", "b", "c" }), aNodes);
+
+	StringGraph anExpectedGraph;
+	anExpectedGraph.Build({ "a", "b", "c" }, { {"a", "b"}, {"b", "c"} });
+	ASSERT_TRUE(aGraph == anExpectedGraph);
+}
+
+// Тест: построение графа по представлению-rvalue копирует узлы: данные представления принадлежат вызывающему.
+TEST(Graph, build_from_rvalue_view_does_not_move_viewed_nodes)
+{
+	std::vector<std::string> aViewedNodes{ "a", "b", "c" };
+	StringGraph aGraph;
+	aGraph.Build(StringSpan{ aViewedNodes.data(), aViewedNodes.data() + aViewedNodes.size() },
+		std::vector<StringGraph::Edge>{ {"a", "b"}, {"b", "c"} });
+	ASSERT_EQ(std::vector<std::string>({ "a", "b", "c" }), aViewedNodes);
+
+	StringGraph anExpectedGraph;
+	anExpectedGraph.Build({ "a", "b", "c" }, { {"a", "b"}, {"b", "c"} });
+	ASSERT_TRUE(aGraph == anExpectedGraph);
+}
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+// Тест: построение графа по std::span копирует узлы: данные представления принадлежат вызывающему.
+TEST(Graph, build_from_span_does_not_move_viewed_nodes)
+{
+	std::vector<std::string> aViewedNodes{ "a", "b", "c" };
+	StringGraph aGraph;
+	aGraph.Build(std::span<std::string>(aViewedNodes), std::vector<StringGraph::Edge>{ {"a", "b"}, {"b", "c"} });
+	ASSERT_EQ(std::vector<std::string>({ "a", "b", "c" }), aViewedNodes);
+
+	StringGraph anExpectedGraph;
+	anExpectedGraph.Build({ "a", "b", "c" }, { {"a", "b"}, {"b", "c"} });
+	ASSERT_TRUE(aGraph == anExpectedGraph);
+}
+#endif
+
+// Тест: может построить граф по однопроходному диапазону узлов.
+TEST(Graph, can_build_graph_from_single_pass_range_of_nodes)
+{
+	std::istringstream aStream("1 2 3 2");
+	IntGraph aGraph;
+	aGraph.Build(IntStreamRange{ aStream }, std::vector<IntGraph::Edge>{ {1, 2}, {2, 3} });
+	ASSERT_EQ(3u, aGraph.GetNodeCount());
+	ASSERT_TRUE(aGraph.ExistsPathBetweenTwoNodes(1, 3));
+}
+
+// Тест: при построении графа по дугам с весами для повторяющихся дуг берется вес последней из них.
+TEST(Graph, build_from_weighted_edges_takes_weight_of_last_repeated_edge)
+{
+	WeightedStringGraph aGraph;
+	aGraph.Build(std::vector<std::string>{ "a", "b" },
+		std::vector<WeightedStringGraph::WeightedEdge>{ { {"a", "b"}, 1.0 }, { {"a", "b"}, 2.5 } });
+	ASSERT_EQ(1u, aGraph.GetEdgeCount());
+	ASSERT_EQ(2.5, aGraph.GetEdgeWeight({ "a", "b" }));
+}
+
+// Тест: не может построить граф по дугам с отрицательным весом.
+TEST(Graph, can_not_build_graph_from_edges_with_negative_weight)
+{
+	WeightedStringGraph aGraph;
+	ASSERT_ANY_THROW(aGraph.Build(std::vector<std::string>{ "a", "b" },
+		std::vector<WeightedStringGraph::WeightedEdge>{ { {"a", "b"}, -1.0 } }));
+}
+
+// Тест: параллельное построение графа по большому неупорядоченному пакету дуг.
+TEST(Graph, build_parallel_matches_build)
+{
+	const int aNodeCount = 5000;
+	std::vector<int> aNodes;
+	for (int i = aNodeCount - 1; i >= 0; --i)
+	{
+		aNodes.push_back(i);
+	}
+	std::vector<IntGraph::Edge> anEdges;
+	for (int i = 0; i < 200000; ++i)
+	{
+		anEdges.push_back({ (i * 7919) % aNodeCount, (i % 1000 * 104729 + i / 3) % aNodeCount }); // с повторами
+	}
+
+	IntGraph anExpectedGraph;
+	for (int aNode : aNodes)
+	{
+		anExpectedGraph.AddNode(aNode);
+	}
+	for (const IntGraph::Edge& anEdge : anEdges)
+	{
+		anExpectedGraph.AddEdge(anEdge);
+	}
+
+	IntGraph aGraph;
+	aGraph.BuildParallel(aNodes, anEdges, 4);
+	ASSERT_EQ(anExpectedGraph.GetEdgeCount(), aGraph.GetEdgeCount());
+	ASSERT_TRUE(aGraph == anExpectedGraph);
+
+	// дуга с отсутствующим узлом обнаруживается до изменения списков смежности
+	anEdges.push_back({ 0, aNodeCount });
+	IntGraph aBadGraph;
+	ASSERT_ANY_THROW(aBadGraph.BuildParallel(aNodes, anEdges, 4));
+	ASSERT_EQ(0u, aBadGraph.GetEdgeCount());
+
+	// у повторяющихся дуг остается вес последней из них
+	std::vector<WeightedStringGraph::WeightedEdge> aWeightedEdges{ { {"a", "b"}, 1.0 }, { {"b", "a"}, 3.0 }, { {"a", "b"}, 2.0 } };
+	WeightedStringGraph aWeightedGraph;
+	aWeightedGraph.BuildParallel(std::vector<std::string>{ "a", "b" }, aWeightedEdges);
+	ASSERT_EQ(2u, aWeightedGraph.GetEdgeCount());
+	ASSERT_EQ(2.0, aWeightedGraph.GetEdgeWeight({ "a", "b" }));
+}
+
+// Тест: равенство графов не зависит от порядка, в котором узлам назначены идентификаторы.
+TEST(Graph, equality_does_not_depend_on_node_ids)
+{
+	WeightedStringGraph aGraph;
+	aGraph.Build({ "a", "b", "c" }, WeightedStringGraph::WeightedEdgeList{ { {"a", "b"}, 1.0 }, { {"a", "c"}, 2.0 }, { {"c", "a"}, 3.0 } });
+
+	WeightedStringGraph anOtherGraph;
+	anOtherGraph.Build({ "c", "b", "a" }, WeightedStringGraph::WeightedEdgeList{ { {"c", "a"}, 3.0 }, { {"a", "c"}, 2.0 }, { {"a", "b"}, 1.0 } });
+	ASSERT_TRUE(aGraph == anOtherGraph);
+
+	anOtherGraph.AddEdge({ "a", "c" }, 5.0);
+	ASSERT_FALSE(aGraph == anOtherGraph);
+
+	anOtherGraph.AddEdge({ "a", "c" }, 2.0);
+	anOtherGraph.RemoveNode("b");
+	anOtherGraph.AddNode("d");
+	ASSERT_TRUE(aGraph != anOtherGraph);
+}
+
+// Тест: Узлы типа std::pmr::string, хранимые графом, выделяют память из ресурса графа.
+TEST(Graph, pmr_string_nodes_allocate_memory_from_given_memory_resource)
+{
+	std::pmr::monotonic_buffer_resource aMemoryResource;
+	// строки длиннее буфера малой строки, чтобы их копии выделяли память
+	const std::pmr::string aFirstNode(40, 'a', std::pmr::new_delete_resource());
+	const std::pmr::string aSecondNode(40, 'b', std::pmr::new_delete_resource());
+	const std::pair<std::pmr::string, std::pmr::string> anEdge(aFirstNode, aSecondNode);
+
+	std::pmr::memory_resource* aDefaultResource = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+	bool aPathExists = false;
+	try
+	{
+		Graph<std::pmr::string> aGraph(&aMemoryResource);
+		aGraph.AddNode(aFirstNode);
+		aGraph.AddNode(aSecondNode);
+		aGraph.AddEdge(anEdge);
+		aPathExists = aGraph.ExistsPathBetweenTwoNodes(aFirstNode, aSecondNode);
+	}
+	catch (...)
+	{
+		std::pmr::set_default_resource(aDefaultResource);
+		FAIL() << "Graph node allocated memory outside of given memory resource";
+	}
+	std::pmr::set_default_resource(aDefaultResource);
+
+	ASSERT_TRUE(aPathExists);
+}
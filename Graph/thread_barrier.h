@@ -0,0 +1,76 @@
+#pragma once
+
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+// ,   ThreadBarrier::Wait   .
+class ThreadBarrierAbortedException : public std::exception
+{
+public:
+	const char* what() const noexcept override { return "Thread barrier is aborted"; }
+};
+
+//     : ,  Wait, ,  Wait    .
+//  :       ,     .
+//            ,   (Abort),
+//       .
+class ThreadBarrier
+{
+public:
+	explicit ThreadBarrier(size_t theThreadCount) : myThreadCount(theThreadCount) {}
+
+	//      .
+	//   ThreadBarrierAbortedException,        .
+	void Wait();
+
+	//   :      Wait  .
+	void Abort();
+
+private:
+	std::mutex myMutex;
+	std::condition_variable myCondition;
+	size_t myThreadCount;      //  
+	size_t myWaitingCount = 0; //  ,   
+	size_t myGeneration = 0;   //   
+	bool myIsAborted = false;  //   
+};
+
+//=========================================================
+// Function : Wait
+// Purpose  :     
+//=========================================================
+inline void ThreadBarrier::Wait()
+{
+	std::unique_lock<std::mutex> aLock(myMutex);
+	if (myIsAborted)
+	{
+		throw ThreadBarrierAbortedException();
+	}
+	const size_t aGeneration = myGeneration;
+	if (++myWaitingCount == myThreadCount)
+	{
+		myWaitingCount = 0;
+		++myGeneration;
+		myCondition.notify_all();
+		return;
+	}
+	myCondition.wait(aLock, [this, aGeneration] { return myGeneration != aGeneration || myIsAborted; });
+	if (myGeneration == aGeneration)
+	{
+		throw ThreadBarrierAbortedException();
+	}
+}
+
+//=========================================================
+// Function : Abort
+// Purpose  :  
+//=========================================================
+inline void ThreadBarrier::Abort()
+{
+	{
+		std::lock_guard<std::mutex> aLock(myMutex);
+		myIsAborted = true;
+	}
+	myCondition.notify_all();
+}
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <algorithm>
+
+#include "thread_barrier.h"
+
+//      (. parallel_bfs.h, delta_stepping.h, parallel_radix_sort.h).
+//      ,    ,     ,
+//           .
+//      (. ThreadBarrier)    ,
+//     :  Run      .
+// ,      ,  RunIndependent:   ,  
+//   ,      .
+//         .
+//     , Run         .
+class ThreadPool
+{
+public:
+	ThreadPool() = default;
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+	~ThreadPool();
+
+	//        -   .
+	static size_t GetDefaultThreadCount() { return std::max<size_t>(1, std::thread::hardware_concurrency()); }
+
+	//    theWork(i)   i  [0, theThreadCount): theWork(0) -   ,
+	//  -    .  ,    .
+	// theBarrier - ,     ( ):  ,    ,
+	//        .      .
+	template <class Work>
+	void Run(size_t theThreadCount, Work& theWork, ThreadBarrier* theBarrier = nullptr);
+
+	//   theWork(i)   i  [0, theThreadCount)  ,  Run,   .
+	//     ,        .
+	//       (,      ).
+	template <class Work>
+	void RunIndependent(size_t theThreadCount, Work& theWork);
+
+private:
+	//    Run.       (myRunMutex).
+	template <class Work>
+	void runLocked(size_t theThreadCount, Work& theWork, ThreadBarrier* theBarrier);
+
+	//      (    )    .
+	void fail(std::exception_ptr theException);
+
+	//      theIndex ( 1):  ,     theGeneration,
+	//       ,     theIndex + 1 .
+	void workerLoop(size_t theIndex, size_t theGeneration);
+
+private:
+	std::mutex myRunMutex;                      //    
+	std::mutex myMutex;                         //   
+	std::condition_variable myStartCondition;   //     
+	std::condition_variable myFinishCondition;  //      
+	std::vector<std::thread> myWorkers;         //   ( i   i + 1)
+	void (*myInvoke)(void*, size_t) = nullptr;  //    
+	void* myWork = nullptr;                     //   
+	ThreadBarrier* myBarrier = nullptr;         //    ( )
+	std::exception_ptr myException;             //     
+	size_t myThreadCount = 0;                   //    
+	size_t myPendingCount = 0;                  //   ,     
+	size_t myGeneration = 0;                    //   
+	bool myIsStopping = false;                  //   
+};
+
+//    ,    .
+inline ThreadPool& GetThreadPool();
+
+//=========================================================
+// Function : ~ThreadPool
+// Purpose  : 
+//=========================================================
+inline ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> aLock(myMutex);
+		myIsStopping = true;
+	}
+	myStartCondition.notify_all();
+	for (std::thread& aWorker : myWorkers)
+	{
+		aWorker.join();
+	}
+}
+
+//=========================================================
+// Function : Run
+// Purpose  :      
+//=========================================================
+template <class Work>
+void ThreadPool::Run(size_t theThreadCount, Work& theWork, ThreadBarrier* theBarrier)
+{
+	if (theThreadCount <= 1)
+	{
+		theWork(size_t(0));
+		return;
+	}
+
+	std::lock_guard<std::mutex> aRunLock(myRunMutex);
+	runLocked(theThreadCount, theWork, theBarrier);
+}
+
+//=========================================================
+// Function : RunIndependent
+// Purpose  :       
+//=========================================================
+template <class Work>
+void ThreadPool::RunIndependent(size_t theThreadCount, Work& theWork)
+{
+	std::unique_lock<std::mutex> aRunLock(myRunMutex, std::defer_lock);
+	if (theThreadCount <= 1 || !aRunLock.try_lock())
+	{
+		for (size_t i = 0; i < theThreadCount; ++i)
+		{
+			theWork(i);
+		}
+		return;
+	}
+	runLocked(theThreadCount, theWork, nullptr);
+}
+
+//=========================================================
+// Function : runLocked
+// Purpose  :     
+//=========================================================
+template <class Work>
+void ThreadPool::runLocked(size_t theThreadCount, Work& theWork, ThreadBarrier* theBarrier)
+{
+	{
+		std::lock_guard<std::mutex> aLock(myMutex);
+		while (myWorkers.size() + 1 < theThreadCount)
+		{
+			//       ,     
+			myWorkers.emplace_back(&ThreadPool::workerLoop, this, myWorkers.size() + 1, myGeneration);
+		}
+		myInvoke = [](void* theWorkObject, size_t theIndex) { (*static_cast<Work*>(theWorkObject))(theIndex); };
+		myWork = &theWork;
+		myBarrier = theBarrier;
+		myException = nullptr;
+		myThreadCount = theThreadCount;
+		myPendingCount = theThreadCount - 1;
+		++myGeneration;
+	}
+	myStartCondition.notify_all();
+
+	try
+	{
+		theWork(size_t(0)); //   -    
+	}
+	catch (...)
+	{
+		fail(std::current_exception());
+	}
+
+	//      ,      ,   
+	std::exception_ptr anException;
+	{
+		std::unique_lock<std::mutex> aLock(myMutex);
+		myFinishCondition.wait(aLock, [this] { return myPendingCount == 0; });
+		anException = std::move(myException);
+		myException = nullptr;
+	}
+	if (anException)
+	{
+		std::rethrow_exception(anException);
+	}
+}
+
+//=========================================================
+// Function : fail
+// Purpose  :    
+//=========================================================
+inline void ThreadPool::fail(std::exception_ptr theException)
+{
+	ThreadBarrier* aBarrier = nullptr;
+	{
+		std::lock_guard<std::mutex> aLock(myMutex);
+		//       , -   ,
+		//      .
+		if (!myException)
+		{
+			myException = theException;
+		}
+		aBarrier = myBarrier;
+	}
+	if (aBarrier != nullptr)
+	{
+		aBarrier->Abort();
+	}
+}
+
+//=========================================================
+// Function : workerLoop
+// Purpose  :   
+//=========================================================
+inline void ThreadPool::workerLoop(size_t theIndex, size_t theGeneration)
+{
+	std::unique_lock<std::mutex> aLock(myMutex);
+	while (true)
+	{
+		myStartCondition.wait(aLock, [this, theGeneration] { return myIsStopping || myGeneration != theGeneration; });
+		if (myIsStopping)
+			return;
+		theGeneration = myGeneration;
+		if (theIndex >= myThreadCount)
+			continue; //      
+
+		//    ,      
+		aLock.unlock();
+		try
+		{
+			myInvoke(myWork, theIndex);
+		}
+		catch (...)
+		{
+			fail(std::current_exception());
+		}
+		aLock.lock();
+		if (--myPendingCount == 0)
+		{
+			myFinishCondition.notify_one();
+		}
+	}
+}
+
+//=========================================================
+// Function : GetThreadPool
+// Purpose  :   
+//=========================================================
+inline ThreadPool& GetThreadPool()
+{
+	static ThreadPool aPool;
+	return aPool;
+}
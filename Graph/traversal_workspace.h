@@ -0,0 +1,125 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+//     .
+enum class TraversalPolicy
+{
+	TopDown,             //   :  ,    
+	DirectionOptimizing, //    :   ,    
+	                     //      (  ),  -   
+	Parallel             //     ,       (. parallel_bfs.h)
+};
+
+//    :        .
+//      :      
+// (       ,  ),      .
+//      ():   ,     
+//  ,        ,   .
+//    :      (. GetThreadTraversalWorkspace).
+class TraversalWorkspace
+{
+public:
+	typedef uint32_t NodeId; //  
+
+	//        ,     theIdBound:
+	//      .
+	void Reset(size_t theIdBound);
+
+	//     .  true,       .
+	bool Visit(NodeId theId);
+
+	//   true,     .
+	bool IsVisited(NodeId theId) const { return myMarks[theId] == myEpoch; }
+
+	//      .
+	void Push(NodeId theId) { myQueue.push_back(theId); }
+
+	//      .  false,   .
+	bool Pop(NodeId& theId);
+
+	//    ,         Reset.
+	size_t GetPushedCount() const { return myQueue.size(); }
+
+	//   ,       theId (  ).
+	void SetParent(NodeId theId, NodeId theParentId) { myParents[theId] = theParentId; }
+
+	//   ,  SetParent.     ,    .
+	NodeId GetParent(NodeId theId) const { return myParents[theId]; }
+
+private:
+	std::vector<uint32_t> myMarks; //  ,      ( -  )
+	uint32_t myEpoch = 0;          //   
+	std::vector<NodeId> myParents; //      ( :     )
+	std::vector<NodeId> myQueue;   //     (      Reset)
+	size_t myQueueHead = 0;        //   
+};
+
+constexpr size_t ThreadTraversalWorkspaceCount = 2; //      
+
+//        theIndex,   .
+//      ,     
+// (,  ): 0 -  , 1 -   .
+inline TraversalWorkspace& GetThreadTraversalWorkspace(size_t theIndex = 0);
+
+//=========================================================
+// Function : Reset
+// Purpose  :      
+//=========================================================
+inline void TraversalWorkspace::Reset(size_t theIdBound)
+{
+	if (myMarks.size() < theIdBound)
+	{
+		myMarks.resize(theIdBound, 0);
+		myParents.resize(theIdBound, 0);
+	}
+	++myEpoch;
+	if (myEpoch == 0)
+	{
+		//    -       
+		std::fill(myMarks.begin(), myMarks.end(), 0);
+		myEpoch = 1;
+	}
+	myQueue.clear();
+	myQueueHead = 0;
+}
+
+//=========================================================
+// Function : Visit
+// Purpose  :    
+//=========================================================
+inline bool TraversalWorkspace::Visit(NodeId theId)
+{
+	if (myMarks[theId] == myEpoch)
+	{
+		return false;
+	}
+	myMarks[theId] = myEpoch;
+	return true;
+}
+
+//=========================================================
+// Function : Pop
+// Purpose  :    
+//=========================================================
+inline bool TraversalWorkspace::Pop(NodeId& theId)
+{
+	if (myQueueHead == myQueue.size())
+	{
+		return false;
+	}
+	theId = myQueue[myQueueHead++];
+	return true;
+}
+
+//=========================================================
+// Function : GetThreadTraversalWorkspace
+// Purpose  :     
+//=========================================================
+inline TraversalWorkspace& GetThreadTraversalWorkspace(size_t theIndex)
+{
+	thread_local TraversalWorkspace aWorkspaces[ThreadTraversalWorkspaceCount];
+	return aWorkspaces[theIndex];
+}